@@ -12,6 +12,7 @@ else()
     message(STATUS "Multithreading is disabled.")
     add_definitions(-DNO_MULTITHREADING)
     set(OMP_MULTITHREADING OFF)
+    set(WORK_STEALING_MULTITHREADING OFF)
 endif()
 
 if(OMP_MULTITHREADING)
@@ -23,6 +24,11 @@ else()
     message(STATUS "OMP multithreading is disabled.")
 endif()
 
+if(WORK_STEALING_MULTITHREADING AND NOT OMP_MULTITHREADING)
+    message(STATUS "Work-stealing multithreading is enabled.")
+    add_definitions(-DWORK_STEALING_MULTITHREADING)
+endif()
+
 if(ENABLE_PAR_ALGOS)
     find_package(TBB QUIET OPTIONAL_COMPONENTS tbb)
     if(${TBB_FOUND})
@@ -0,0 +1,292 @@
+#include "barretenberg/api/serve.hpp"
+#include "barretenberg/api/api_avm.hpp"
+#include "barretenberg/api/api_client_ivc.hpp"
+#include "barretenberg/api/api_ultra_honk.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/messaging/stream_parser.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <vector>
+#ifndef __wasm__
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace bb {
+
+API::Flags ServeFlags::to_api_flags(const API::Flags& defaults) const
+{
+    API::Flags flags = defaults;
+    flags.scheme = scheme;
+    flags.oracle_hash_type = oracle_hash_type;
+    flags.output_format = output_format;
+    flags.verifier_type = verifier_type;
+    flags.disable_zk = disable_zk;
+    flags.write_vk = write_vk;
+    flags.ipa_accumulation = ipa_accumulation;
+    flags.init_kzg_accumulator = init_kzg_accumulator;
+    flags.recursive = recursive;
+    flags.honk_recursion = honk_recursion;
+    return flags;
+}
+
+#ifndef __wasm__
+namespace {
+
+bool read_exact(int fd, uint8_t* data, size_t size)
+{
+    size_t total_read = 0;
+    while (total_read < size) {
+        ssize_t n = ::read(fd, data + total_read, size - total_read);
+        if (n == -1 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        total_read += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+void write_all(int fd, const uint8_t* data, size_t size)
+{
+    size_t total_written = 0;
+    while (total_written < size) {
+        ssize_t n = ::write(fd, data + total_written, size - total_written);
+        if (n == -1 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            throw_or_abort(std::string("bb serve: failed to write response: ") + strerror(errno));
+        }
+        total_written += static_cast<size_t>(n);
+    }
+}
+
+/**
+ * @brief Reads one length-prefixed frame. Returns false on a clean or truncated end of stream, or if the frame is
+ * larger than SERVE_MAX_FRAME_SIZE.
+ */
+bool read_frame(int fd, std::vector<uint8_t>& frame)
+{
+    std::array<uint8_t, 4> prefix{};
+    if (!read_exact(fd, prefix.data(), prefix.size())) {
+        return false;
+    }
+    uint32_t size = static_cast<uint32_t>(prefix[0]) | (static_cast<uint32_t>(prefix[1]) << 8) |
+                    (static_cast<uint32_t>(prefix[2]) << 16) | (static_cast<uint32_t>(prefix[3]) << 24);
+    if (size > SERVE_MAX_FRAME_SIZE) {
+        info("bb serve: closing the connection, frame of ", size, " bytes exceeds the limit of ", SERVE_MAX_FRAME_SIZE);
+        return false;
+    }
+    frame.resize(size);
+    return read_exact(fd, frame.data(), size);
+}
+
+/**
+ * @brief The OutputStream consumed by messaging::StreamDispatcher: packs a message and writes it as one frame.
+ */
+class FrameWriter {
+  public:
+    explicit FrameWriter(int fd)
+        : fd_(fd)
+    {}
+
+    template <typename T> void send(const T& message)
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, message);
+        auto size = static_cast<uint32_t>(buffer.size());
+        std::array<uint8_t, 4> prefix{ static_cast<uint8_t>(size),
+                                       static_cast<uint8_t>(size >> 8),
+                                       static_cast<uint8_t>(size >> 16),
+                                       static_cast<uint8_t>(size >> 24) };
+        write_all(fd_, prefix.data(), prefix.size());
+        write_all(fd_, reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size());
+    }
+
+  private:
+    int fd_;
+};
+
+ServeResponse serve_prove(const API::Flags& defaults, const ServeProveRequest& request)
+{
+    API::Flags flags = request.flags.to_api_flags(defaults);
+    std::filesystem::create_directories(request.output_path);
+    if (flags.scheme == "ultra_honk") {
+        UltraHonkAPI api;
+        api.prove(flags, request.bytecode_path, request.witness_path, request.vk_path, request.output_path);
+    } else if (flags.scheme == "client_ivc") {
+        if (!std::filesystem::exists(request.inputs_path)) {
+            throw_or_abort("The prove command for ClientIVC expects a valid inputs_path");
+        }
+        ClientIVCAPI api;
+        api.prove(flags, request.inputs_path, request.output_path);
+    } else if (flags.scheme == "avm") {
+#ifndef DISABLE_AZTEC_VM
+        avm_prove(request.inputs_path, request.output_path);
+#else
+        throw_or_abort("The Aztec Virtual Machine (AVM) is disabled in this environment!");
+#endif
+    } else {
+        throw_or_abort("bb serve: unsupported scheme " + flags.scheme);
+    }
+    return { .success = true, .error = "" };
+}
+
+ServeResponse serve_verify(const API::Flags& defaults, const ServeVerifyRequest& request)
+{
+    API::Flags flags = request.flags.to_api_flags(defaults);
+    bool verified = false;
+    if (flags.scheme == "ultra_honk") {
+        UltraHonkAPI api;
+        verified = api.verify(flags, request.public_inputs_path, request.proof_path, request.vk_path);
+    } else if (flags.scheme == "client_ivc") {
+        ClientIVCAPI api;
+        verified = api.verify(flags, request.public_inputs_path, request.proof_path, request.vk_path);
+    } else if (flags.scheme == "avm") {
+#ifndef DISABLE_AZTEC_VM
+        verified = avm_verify(request.proof_path, request.public_inputs_path, request.vk_path);
+#else
+        throw_or_abort("The Aztec Virtual Machine (AVM) is disabled in this environment!");
+#endif
+    } else {
+        throw_or_abort("bb serve: unsupported scheme " + flags.scheme);
+    }
+    vinfo("verified: ", verified);
+    return { .success = verified, .error = "" };
+}
+
+ServeResponse serve_write_vk(const API::Flags& defaults, const ServeWriteVkRequest& request)
+{
+    API::Flags flags = request.flags.to_api_flags(defaults);
+    std::filesystem::create_directories(request.output_path);
+    if (flags.scheme == "ultra_honk") {
+        UltraHonkAPI api;
+        api.write_vk(flags, request.bytecode_path, request.output_path);
+    } else if (flags.scheme == "client_ivc") {
+        ClientIVCAPI api;
+        api.write_vk(flags, request.bytecode_path, request.output_path);
+    } else {
+        throw_or_abort("bb serve: unsupported scheme " + flags.scheme);
+    }
+    return { .success = true, .error = "" };
+}
+
+/**
+ * @brief Wraps a command so that it decodes its request, runs, and always answers with a ServeResponse. A failing
+ * command must not take the daemon (and its warm state) down with it.
+ */
+template <typename Request>
+std::function<bool(msgpack::object&)> make_handler(
+    FrameWriter& out,
+    uint32_t msg_type,
+    const API::Flags& defaults,
+    const std::function<ServeResponse(const API::Flags&, const Request&)>& command)
+{
+    return [&out, msg_type, &defaults, command](msgpack::object& obj) {
+        messaging::TypedMessage<Request> request;
+        request.header = messaging::MsgHeader(0, 0);
+        ServeResponse response;
+        try {
+            obj.convert(request);
+            response = command(defaults, request.value);
+        } catch (const std::exception& e) {
+            info("bb serve: request ", request.header.messageId, " failed: ", e.what());
+            response = { .success = false, .error = e.what() };
+        }
+        messaging::MsgHeader header(request.header.messageId);
+        out.send(messaging::TypedMessage<ServeResponse>(msg_type, header, response));
+        return true;
+    };
+}
+
+} // namespace
+
+bool serve_session(const API::Flags& defaults, int in_fd, int out_fd)
+{
+    FrameWriter out(out_fd);
+    messaging::StreamDispatcher<FrameWriter> dispatcher(out);
+
+    auto prove_handler = make_handler<ServeProveRequest>(out, SERVE_PROVE, defaults, serve_prove);
+    auto verify_handler = make_handler<ServeVerifyRequest>(out, SERVE_VERIFY, defaults, serve_verify);
+    auto write_vk_handler = make_handler<ServeWriteVkRequest>(out, SERVE_WRITE_VK, defaults, serve_write_vk);
+    dispatcher.registerTarget(SERVE_PROVE, prove_handler);
+    dispatcher.registerTarget(SERVE_VERIFY, verify_handler);
+    dispatcher.registerTarget(SERVE_WRITE_VK, write_vk_handler);
+
+    std::vector<uint8_t> frame;
+    while (read_frame(in_fd, frame)) {
+        // Command failures are answered by the handlers. What gets here is a frame we could not make sense of (bad
+        // msgpack, no message header), which we cannot answer since we do not know which request it was.
+        try {
+            msgpack::object_handle handle = msgpack::unpack(reinterpret_cast<const char*>(frame.data()), frame.size());
+            msgpack::object obj = handle.get();
+            if (!dispatcher.onNewData(obj)) {
+                return false;
+            }
+        } catch (const std::exception& e) {
+            info("bb serve: dropping a frame of ", frame.size(), " bytes: ", e.what());
+        }
+    }
+    return true;
+}
+#endif
+
+int serve([[maybe_unused]] const API::Flags& flags, [[maybe_unused]] const std::filesystem::path& socket_path)
+{
+#ifdef __wasm__
+    throw_or_abort("bb serve is not supported in wasm");
+    return 1;
+#else
+    if (socket_path.empty()) {
+        info("bb serve: listening on stdin");
+        serve_session(flags, STDIN_FILENO, STDOUT_FILENO);
+        return 0;
+    }
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socket_path.native().size() >= sizeof(address.sun_path)) {
+        throw_or_abort("bb serve: socket path too long: " + socket_path.string());
+    }
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    int server_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server_fd == -1) {
+        throw_or_abort(std::string("bb serve: socket() failed: ") + strerror(errno));
+    }
+    std::filesystem::remove(socket_path);
+    if (bind(server_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == -1 || listen(server_fd, 1) == -1) {
+        close(server_fd);
+        throw_or_abort("bb serve: failed to listen on " + socket_path.string() + ": " + strerror(errno));
+    }
+    info("bb serve: listening on ", socket_path);
+
+    // Connections are served one at a time: proving already uses every core, so there is nothing to gain from
+    // running requests concurrently.
+    bool keep_serving = true;
+    while (keep_serving) {
+        int client_fd = accept(server_fd, nullptr, nullptr);
+        if (client_fd == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        keep_serving = serve_session(flags, client_fd, client_fd);
+        close(client_fd);
+    }
+    close(server_fd);
+    std::filesystem::remove(socket_path);
+    return 0;
+#endif
+}
+
+} // namespace bb
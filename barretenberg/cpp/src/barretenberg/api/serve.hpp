@@ -0,0 +1,119 @@
+#pragma once
+#include "barretenberg/api/api.hpp"
+#include "barretenberg/messaging/header.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace bb {
+
+/**
+ * @brief Message types understood by `bb serve`.
+ * @details Requests are `messaging::TypedMessage<Request>` values; every request is answered with a
+ * `messaging::TypedMessage<ServeResponse>` of the same type whose header carries the request's messageId as requestId.
+ * The system messages in messaging/header.hpp (TERMINATE, PING) are also accepted.
+ */
+enum ServeMessageType {
+    SERVE_PROVE = messaging::FIRST_APP_MSG_TYPE,
+    SERVE_VERIFY,
+    SERVE_WRITE_VK,
+};
+
+/**
+ * @brief The subset of API::Flags a client may set per request. Mirrors the CLI options of the same name.
+ */
+struct ServeFlags {
+    std::string scheme = "ultra_honk";
+    std::string oracle_hash_type = "poseidon2";
+    std::string output_format = "bytes";
+    std::string verifier_type = "standalone";
+    bool disable_zk = false;
+    bool write_vk = false;
+    bool ipa_accumulation = false;
+    bool init_kzg_accumulator = false;
+    bool recursive = false;
+    uint32_t honk_recursion = 0;
+
+    MSGPACK_FIELDS(scheme,
+                   oracle_hash_type,
+                   output_format,
+                   verifier_type,
+                   disable_zk,
+                   write_vk,
+                   ipa_accumulation,
+                   init_kzg_accumulator,
+                   recursive,
+                   honk_recursion);
+
+    API::Flags to_api_flags(const API::Flags& defaults) const;
+};
+
+struct ServeProveRequest {
+    ServeFlags flags;
+    std::string bytecode_path;
+    std::string witness_path;
+    std::string inputs_path; // client_ivc: the msgpack input stack; avm: the serialized avm inputs
+    std::string vk_path;
+    std::string output_path;
+
+    MSGPACK_FIELDS(flags, bytecode_path, witness_path, inputs_path, vk_path, output_path);
+};
+
+struct ServeVerifyRequest {
+    ServeFlags flags;
+    std::string public_inputs_path;
+    std::string proof_path;
+    std::string vk_path;
+
+    MSGPACK_FIELDS(flags, public_inputs_path, proof_path, vk_path);
+};
+
+struct ServeWriteVkRequest {
+    ServeFlags flags;
+    std::string bytecode_path;
+    std::string output_path;
+
+    MSGPACK_FIELDS(flags, bytecode_path, output_path);
+};
+
+/**
+ * @brief Largest frame payload `bb serve` accepts.
+ * @details Requests carry file paths rather than file contents, so real frames are a few hundred bytes. A larger length
+ * prefix comes from a broken or hostile client; the connection is closed before anything is allocated for it.
+ */
+constexpr uint32_t SERVE_MAX_FRAME_SIZE = 1 << 20;
+
+/**
+ * @brief For verify requests `success` is the verification result; otherwise it reports whether the command completed.
+ * `error` holds the exception message when a command failed.
+ */
+struct ServeResponse {
+    bool success = false;
+    std::string error;
+
+    MSGPACK_FIELDS(success, error);
+};
+
+/**
+ * @brief Serves requests read from in_fd until end of stream or TERMINATE, writing responses to out_fd.
+ * @details A frame that cannot be decoded or dispatched is logged and dropped; the session keeps serving. A frame
+ * longer than SERVE_MAX_FRAME_SIZE ends the session, as the rest of the stream can no longer be trusted.
+ * @return false if the client asked the daemon to terminate.
+ */
+bool serve_session(const API::Flags& defaults, int in_fd, int out_fd);
+
+/**
+ * @brief Run bb as a long-lived prover daemon.
+ * @details Messages are framed as a 4-byte little-endian length followed by that many bytes of msgpack. The global
+ * CRS and the plookup multitables are process-wide, so they are built on the first request and reused by every later
+ * one. Logs go to stderr as usual.
+ *
+ * @param flags Process-wide defaults (crs path, logging).
+ * @param socket_path If empty, serve a single session over stdin/stdout. Otherwise listen on this Unix socket and serve
+ * connections one after another until a TERMINATE message is received.
+ * @return int Process exit code.
+ */
+int serve(const API::Flags& flags, const std::filesystem::path& socket_path);
+
+} // namespace bb
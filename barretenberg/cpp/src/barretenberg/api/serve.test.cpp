@@ -0,0 +1,214 @@
+#ifndef __wasm__
+#include "barretenberg/api/serve.hpp"
+#include "barretenberg/messaging/header.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace bb;
+using namespace bb::messaging;
+
+namespace {
+
+void write_raw_frame(int fd, const std::vector<uint8_t>& payload)
+{
+    auto size = static_cast<uint32_t>(payload.size());
+    std::array<uint8_t, 4> prefix{ static_cast<uint8_t>(size),
+                                   static_cast<uint8_t>(size >> 8),
+                                   static_cast<uint8_t>(size >> 16),
+                                   static_cast<uint8_t>(size >> 24) };
+    ASSERT_EQ(::write(fd, prefix.data(), prefix.size()), static_cast<ssize_t>(prefix.size()));
+    ASSERT_EQ(::write(fd, payload.data(), payload.size()), static_cast<ssize_t>(payload.size()));
+}
+
+template <typename T> void write_frame(int fd, const T& message)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, message);
+    write_raw_frame(fd, std::vector<uint8_t>(buffer.data(), buffer.data() + buffer.size()));
+}
+
+template <typename T> T read_frame(int fd)
+{
+    std::array<uint8_t, 4> prefix{};
+    EXPECT_EQ(::read(fd, prefix.data(), prefix.size()), static_cast<ssize_t>(prefix.size()));
+    uint32_t size = static_cast<uint32_t>(prefix[0]) | (static_cast<uint32_t>(prefix[1]) << 8) |
+                    (static_cast<uint32_t>(prefix[2]) << 16) | (static_cast<uint32_t>(prefix[3]) << 24);
+    std::vector<char> payload(size);
+    EXPECT_EQ(::read(fd, payload.data(), size), static_cast<ssize_t>(size));
+    T message;
+    msgpack::unpack(payload.data(), payload.size()).get().convert(message);
+    return message;
+}
+
+HeaderOnlyMessage ping_message(uint32_t message_id)
+{
+    MsgHeader header(message_id, 0);
+    return HeaderOnlyMessage(PING, header);
+}
+
+HeaderOnlyMessage terminate_message()
+{
+    MsgHeader header(0, 0);
+    return HeaderOnlyMessage(TERMINATE, header);
+}
+
+// Requests are queued up front and the session runs to completion on the test thread. The pipes have room for every
+// message the tests exchange.
+class ServeSessionTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(pipe(requests.data()), 0);
+        ASSERT_EQ(pipe(responses.data()), 0);
+    }
+
+    void TearDown() override
+    {
+        close(requests[0]);
+        close(responses[0]);
+    }
+
+    bool run_session()
+    {
+        close(requests[1]);
+        bool keep_serving = serve_session(API::Flags{}, requests[0], responses[1]);
+        close(responses[1]);
+        return keep_serving;
+    }
+
+    bool no_more_responses()
+    {
+        uint8_t byte = 0;
+        return ::read(responses[0], &byte, 1) == 0;
+    }
+
+    std::array<int, 2> requests{};
+    std::array<int, 2> responses{};
+};
+
+} // namespace
+
+TEST_F(ServeSessionTest, AnswersPingAndStopsOnTerminate)
+{
+    write_frame(requests[1], ping_message(7));
+    write_frame(requests[1], terminate_message());
+    // Never read: the session stops at TERMINATE
+    write_frame(requests[1], ping_message(8));
+
+    EXPECT_FALSE(run_session());
+
+    auto pong = read_frame<HeaderOnlyMessage>(responses[0]);
+    EXPECT_EQ(pong.msgType, static_cast<uint32_t>(PONG));
+    EXPECT_EQ(pong.header.requestId, 7U);
+    EXPECT_TRUE(no_more_responses());
+}
+
+TEST_F(ServeSessionTest, KeepsServingUntilEndOfStream)
+{
+    write_frame(requests[1], ping_message(1));
+
+    EXPECT_TRUE(run_session());
+
+    EXPECT_EQ(read_frame<HeaderOnlyMessage>(responses[0]).header.requestId, 1U);
+    EXPECT_TRUE(no_more_responses());
+}
+
+TEST_F(ServeSessionTest, AnswersFailedCommandWithError)
+{
+    ServeVerifyRequest request;
+    request.flags.scheme = "not_a_scheme";
+    MsgHeader header(42, 0);
+    write_frame(requests[1], TypedMessage<ServeVerifyRequest>(SERVE_VERIFY, header, request));
+
+    EXPECT_TRUE(run_session());
+
+    auto response = read_frame<TypedMessage<ServeResponse>>(responses[0]);
+    EXPECT_EQ(response.msgType, static_cast<uint32_t>(SERVE_VERIFY));
+    EXPECT_EQ(response.header.requestId, 42U);
+    EXPECT_FALSE(response.value.success);
+    EXPECT_NE(response.value.error.find("unsupported scheme"), std::string::npos);
+}
+
+TEST_F(ServeSessionTest, AnswersUndecodableRequestWithError)
+{
+    // A valid header followed by a value that is not a ServeVerifyRequest
+    MsgHeader header(3, 0);
+    write_frame(requests[1], TypedMessage<uint32_t>(SERVE_VERIFY, header, 5));
+
+    EXPECT_TRUE(run_session());
+
+    auto response = read_frame<TypedMessage<ServeResponse>>(responses[0]);
+    EXPECT_EQ(response.msgType, static_cast<uint32_t>(SERVE_VERIFY));
+    EXPECT_FALSE(response.value.success);
+}
+
+TEST_F(ServeSessionTest, DropsMalformedFramesAndKeepsServing)
+{
+    // 0xc1 is never used by msgpack
+    write_raw_frame(requests[1], { 0xc1 });
+    // Valid msgpack, but not a message
+    write_frame(requests[1], uint32_t{ 5 });
+    // A message type with no handler
+    MsgHeader header(4, 0);
+    write_frame(requests[1], HeaderOnlyMessage(FIRST_APP_MSG_TYPE + 1000, header));
+    write_frame(requests[1], ping_message(9));
+
+    EXPECT_TRUE(run_session());
+
+    EXPECT_EQ(read_frame<HeaderOnlyMessage>(responses[0]).header.requestId, 9U);
+    EXPECT_TRUE(no_more_responses());
+}
+
+TEST_F(ServeSessionTest, StopsOnTruncatedFrame)
+{
+    write_frame(requests[1], ping_message(2));
+    // Announces 16 bytes but the stream ends after 2
+    std::array<uint8_t, 6> truncated{ 16, 0, 0, 0, 0x92, 0x01 };
+    ASSERT_EQ(::write(requests[1], truncated.data(), truncated.size()), static_cast<ssize_t>(truncated.size()));
+
+    EXPECT_TRUE(run_session());
+
+    EXPECT_EQ(read_frame<HeaderOnlyMessage>(responses[0]).header.requestId, 2U);
+    EXPECT_TRUE(no_more_responses());
+}
+
+TEST_F(ServeSessionTest, ClosesSessionOnOversizedFrame)
+{
+    write_frame(requests[1], ping_message(5));
+    // Announces 4 GiB - 1 bytes; the session must end here without trying to allocate or read them
+    std::array<uint8_t, 4> oversized{ 0xff, 0xff, 0xff, 0xff };
+    ASSERT_EQ(::write(requests[1], oversized.data(), oversized.size()), static_cast<ssize_t>(oversized.size()));
+    // Never read
+    write_frame(requests[1], ping_message(6));
+
+    // The daemon keeps serving other connections
+    EXPECT_TRUE(run_session());
+
+    EXPECT_EQ(read_frame<HeaderOnlyMessage>(responses[0]).header.requestId, 5U);
+    EXPECT_TRUE(no_more_responses());
+}
+
+TEST_F(ServeSessionTest, AcceptsFrameAtSizeLimit)
+{
+    // A frame of exactly SERVE_MAX_FRAME_SIZE bytes is read in full (and dropped, as it is not a message)
+    std::vector<uint8_t> payload(SERVE_MAX_FRAME_SIZE, 0xc1);
+    std::thread writer([&] {
+        write_raw_frame(requests[1], payload);
+        write_frame(requests[1], ping_message(11));
+        close(requests[1]);
+    });
+    bool keep_serving = serve_session(API::Flags{}, requests[0], responses[1]);
+    writer.join();
+    close(responses[1]);
+
+    EXPECT_TRUE(keep_serving);
+    EXPECT_EQ(read_frame<HeaderOnlyMessage>(responses[0]).header.requestId, 11U);
+    EXPECT_TRUE(no_more_responses());
+}
+#endif
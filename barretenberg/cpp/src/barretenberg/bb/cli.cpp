@@ -19,6 +19,7 @@
 #include "barretenberg/api/api_ultra_honk.hpp"
 #include "barretenberg/api/gate_count.hpp"
 #include "barretenberg/api/prove_tube.hpp"
+#include "barretenberg/api/serve.hpp"
 #include "barretenberg/bb/cli11_formatter.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/ultra_rollup_flavor.hpp"
@@ -414,6 +415,20 @@ int parse_and_run_cli_command(int argc, char* argv[])
     remove_zk_option(write_solidity_verifier);
     add_crs_path_option(write_solidity_verifier);
 
+    /***************************************************************************************************************
+     * Subcommand: serve
+     ***************************************************************************************************************/
+    CLI::App* serve_command =
+        app.add_subcommand("serve",
+                           "Run as a long-lived prover daemon that answers prove, verify and write_vk requests sent as "
+                           "length-prefixed msgpack messages. The CRS and lookup tables stay warm between requests.");
+    add_verbose_flag(serve_command);
+    add_debug_flag(serve_command);
+    add_crs_path_option(serve_command);
+    std::filesystem::path serve_socket_path;
+    serve_command->add_option(
+        "--socket", serve_socket_path, "Listen on this Unix socket instead of reading requests from stdin.");
+
     /***************************************************************************************************************
      * Subcommand: OLD_API
      ***************************************************************************************************************/
@@ -616,6 +631,10 @@ int parse_and_run_cli_command(int argc, char* argv[])
     };
 
     try {
+        // DAEMON
+        if (serve_command->parsed()) {
+            return serve(flags, serve_socket_path);
+        }
         // TUBE
         if (prove_tube_command->parsed()) {
             // TODO(https://github.com/AztecProtocol/barretenberg/issues/1201): Potentially remove this extra logic.
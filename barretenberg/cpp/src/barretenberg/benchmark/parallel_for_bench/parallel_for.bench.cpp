@@ -0,0 +1,162 @@
+/**
+ * @file parallel_for.bench.cpp
+ * @brief Compares the parallel_for backends.
+ * @details The synthetic benchmarks call each backend directly, so a single build compares all of them. The MSM and
+ * sumcheck benchmarks go through parallel_for and therefore measure whichever backend the build selected; compare
+ * them across a default build and one configured with -DWORK_STEALING_MULTITHREADING=ON.
+ */
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/flavor/ultra_flavor.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/sumcheck/sumcheck.hpp"
+#include "barretenberg/transcript/transcript.hpp"
+#include <benchmark/benchmark.h>
+
+namespace bb {
+void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_spawning(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_queued(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+} // namespace bb
+
+using namespace bb;
+using namespace benchmark;
+
+namespace {
+
+using ParallelFor = void (*)(size_t, const std::function<void(size_t)>&);
+
+// Burn roughly `units` field multiplications so the compiler cannot elide the work.
+fr spin(size_t units)
+{
+    fr acc = fr(units + 1);
+    for (size_t i = 0; i < units; ++i) {
+        acc = acc * acc + fr::one();
+    }
+    return acc;
+}
+
+/**
+ * @brief Equal-cost iterations: the best case for static partitioning.
+ */
+template <ParallelFor parallel_for_impl> void uniform(State& state)
+{
+    const size_t num_iterations = static_cast<size_t>(state.range(0));
+    std::vector<fr> results(num_iterations);
+    for (auto _ : state) {
+        parallel_for_impl(num_iterations, [&](size_t i) { results[i] = spin(2000); });
+        DoNotOptimize(results.data());
+    }
+}
+
+/**
+ * @brief Iterations whose cost decays geometrically, like trace generation where a few subtraces dominate.
+ */
+template <ParallelFor parallel_for_impl> void skewed(State& state)
+{
+    const size_t num_iterations = static_cast<size_t>(state.range(0));
+    std::vector<fr> results(num_iterations);
+    for (auto _ : state) {
+        parallel_for_impl(num_iterations,
+                          [&](size_t i) { results[i] = spin((200000 >> std::min<size_t>(i, 16)) + 100); });
+        DoNotOptimize(results.data());
+    }
+}
+
+/**
+ * @brief A parallel_for inside a parallel_for. Only the work-stealing backend supports this.
+ */
+void nested_work_stealing(State& state)
+{
+    const size_t outer = static_cast<size_t>(state.range(0));
+    const size_t inner = 64;
+    std::vector<fr> results(outer * inner);
+    for (auto _ : state) {
+        parallel_for_work_stealing(outer, [&](size_t i) {
+            // Unbalanced outer iterations: the inner loops of the large ones spill over to idle workers.
+            const size_t units = i == 0 ? 4000 : 200;
+            parallel_for_work_stealing(inner, [&](size_t j) { results[i * inner + j] = spin(units); });
+        });
+        DoNotOptimize(results.data());
+    }
+}
+
+BENCHMARK(uniform<parallel_for_mutex_pool>)->Unit(kMillisecond)->Arg(64)->Arg(4096);
+BENCHMARK(uniform<parallel_for_atomic_pool>)->Unit(kMillisecond)->Arg(64)->Arg(4096);
+BENCHMARK(uniform<parallel_for_spawning>)->Unit(kMillisecond)->Arg(64)->Arg(4096);
+BENCHMARK(uniform<parallel_for_queued>)->Unit(kMillisecond)->Arg(64)->Arg(4096);
+BENCHMARK(uniform<parallel_for_work_stealing>)->Unit(kMillisecond)->Arg(64)->Arg(4096);
+
+BENCHMARK(skewed<parallel_for_mutex_pool>)->Unit(kMillisecond)->Arg(64);
+BENCHMARK(skewed<parallel_for_atomic_pool>)->Unit(kMillisecond)->Arg(64);
+BENCHMARK(skewed<parallel_for_spawning>)->Unit(kMillisecond)->Arg(64);
+BENCHMARK(skewed<parallel_for_queued>)->Unit(kMillisecond)->Arg(64);
+BENCHMARK(skewed<parallel_for_work_stealing>)->Unit(kMillisecond)->Arg(64);
+
+BENCHMARK(nested_work_stealing)->Unit(kMillisecond)->Arg(16)->Arg(64);
+
+/**
+ * @brief MSM over generated points, with the compiled-in parallel_for backend.
+ */
+void pippenger(State& state)
+{
+    using Curve = curve::BN254;
+    const size_t num_points = static_cast<size_t>(state.range(0));
+    std::vector<Curve::AffineElement> points(num_points);
+    std::vector<fr> scalars(num_points);
+    // Multiples of the generator are much cheaper to produce than hashed-to-curve points.
+    Curve::Element point = Curve::Element::one();
+    for (size_t i = 0; i < num_points; ++i) {
+        point = point.dbl();
+        points[i] = point;
+        scalars[i] = fr::random_element();
+    }
+    for (auto _ : state) {
+        DoNotOptimize(scalar_multiplication::pippenger_unsafe<Curve>(PolynomialSpan<const fr>(0, scalars), points));
+    }
+}
+BENCHMARK(pippenger)->Unit(kMillisecond)->Arg(1 << 16)->Arg(1 << 18);
+
+/**
+ * @brief Ultra sumcheck over random polynomials, with the compiled-in parallel_for backend.
+ */
+void sumcheck(State& state)
+{
+    using Flavor = UltraFlavor;
+    using FF = Flavor::FF;
+    const size_t log_n = static_cast<size_t>(state.range(0));
+    const size_t n = 1UL << log_n;
+
+    std::vector<Polynomial<FF>> random_polynomials(Flavor::NUM_ALL_ENTITIES);
+    for (auto& poly : random_polynomials) {
+        poly = Polynomial<FF>::random(n);
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        Flavor::ProverPolynomials polynomials;
+        for (auto [poly, random_poly] : zip_view(polynomials.get_all(), random_polynomials)) {
+            poly = random_poly.share();
+        }
+        auto transcript = Flavor::Transcript::prover_init_empty();
+        Flavor::RelationSeparator alpha;
+        for (auto& a : alpha) {
+            a = FF::random_element();
+        }
+        std::vector<FF> gate_challenges(log_n);
+        for (auto& challenge : gate_challenges) {
+            challenge = FF::random_element();
+        }
+        SumcheckProver<Flavor> sumcheck(n, transcript);
+        state.ResumeTiming();
+
+        DoNotOptimize(sumcheck.prove(polynomials, {}, alpha, gate_challenges));
+    }
+}
+BENCHMARK(sumcheck)->Unit(kMillisecond)->Arg(16)->Arg(18);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -14,6 +14,7 @@
  */
 
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/ref_vector.hpp"
 #include "barretenberg/constants.hpp"
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
@@ -24,8 +25,11 @@
 #include "barretenberg/srs/factories/crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <memory>
+#include <span>
 #include <string_view>
 
 namespace bb {
@@ -104,6 +108,69 @@ template <class Curve> class CommitmentKey {
         return point;
     };
 
+    /**
+     * @brief Commit to several independent polynomials at once
+     * @details All commitments are computed by a single MSM::batch_multi_scalar_mul call. Its work units are balanced
+     * across threads over the nonzero scalars of all polynomials together, so a round with many small and medium
+     * polynomials keeps every thread busy, instead of paying for one scalar transform and one thread fan-out per
+     * polynomial. Zero coefficients are skipped, so sparse polynomials only cost their nonzero entries.
+     * @warning The polynomials must not share memory: their coefficients are converted out of and back into Montgomery
+     * form in place.
+     *
+     * @param polynomials
+     * @return std::vector<Commitment> one commitment per polynomial, in order
+     */
+    std::vector<Commitment> batch_commit(std::span<const PolynomialSpan<const Fr>> polynomials) const
+    {
+        PROFILE_THIS_NAME("batch_commit");
+        std::span<const G1> point_table = srs->get_monomial_points();
+
+        std::vector<std::span<const G1>> points;
+        std::vector<std::span<Fr>> scalars;
+        // Index of the polynomial each MSM belongs to; empty polynomials are not part of the batch
+        std::vector<size_t> polynomial_indices;
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            const PolynomialSpan<const Fr>& polynomial = polynomials[i];
+            size_t consumed_srs = polynomial.start_index + polynomial.size();
+            if (consumed_srs > srs->get_monomial_size()) {
+                throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                      consumed_srs,
+                                      " points with an SRS of size ",
+                                      srs->get_monomial_size()));
+            }
+            if (polynomial.size() == 0) {
+                continue;
+            }
+            // See MSM::msm: the scalars are converted in place rather than copied.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            scalars.emplace_back(const_cast<Fr*>(polynomial.span.data()), polynomial.size());
+            points.emplace_back(point_table.subspan(polynomial.start_index));
+            polynomial_indices.emplace_back(i);
+        }
+        assert_disjoint(scalars);
+
+        std::vector<Commitment> commitments(polynomials.size(), Curve::Group::affine_point_at_infinity);
+        if (scalars.empty()) {
+            return commitments;
+        }
+        std::vector<Commitment> results =
+            scalar_multiplication::MSM<Curve>::batch_multi_scalar_mul(points, scalars, /*handle_edge_cases=*/false);
+        for (size_t i = 0; i < results.size(); ++i) {
+            commitments[polynomial_indices[i]] = results[i];
+        }
+        return commitments;
+    }
+
+    std::vector<Commitment> batch_commit(RefVector<Polynomial<Fr>> polynomials) const
+    {
+        std::vector<PolynomialSpan<const Fr>> spans;
+        spans.reserve(polynomials.size());
+        for (auto& polynomial : polynomials) {
+            spans.emplace_back(polynomial);
+        }
+        return batch_commit(spans);
+    }
+
     /**
      * @brief Efficiently commit to a polynomial whose nonzero elements are arranged in discrete blocks
      * @details Given a set of ranges where the polynomial takes non-zero values, copy the non-zero inputs (scalars,
@@ -271,6 +338,21 @@ template <class Curve> class CommitmentKey {
             return commit(poly);
         }
     }
+
+  private:
+    // The batched MSMs convert scalars in place, so a coefficient shared by two inputs would be converted twice.
+    static void assert_disjoint([[maybe_unused]] std::vector<std::span<Fr>> scalars)
+    {
+#ifndef NDEBUG
+        std::sort(scalars.begin(), scalars.end(), [](const auto& a, const auto& b) {
+            return std::less<const Fr*>()(a.data(), b.data());
+        });
+        for (size_t i = 1; i < scalars.size(); ++i) {
+            ASSERT(!std::less<const Fr*>()(scalars[i].data(), scalars[i - 1].data() + scalars[i - 1].size()),
+                   "Polynomials committed to in one batch must not share memory.");
+        }
+#endif
+    }
 };
 
 } // namespace bb
@@ -82,11 +82,15 @@ std::vector<typename GeminiProver_<Curve>::Claim> GeminiProver_<Curve>::prove(
     // Construct the d-1 Gemini foldings of A₀(X)
     std::vector<Polynomial> fold_polynomials = compute_fold_polynomials(log_n, multilinear_challenge, A_0);
 
+    // The fold polynomials are independent of each other, so they are committed to with one batched MSM
+    std::vector<PolynomialSpan<const Fr>> fold_spans(fold_polynomials.begin(), fold_polynomials.end());
+    std::vector<Commitment> fold_commitments = commitment_key.batch_commit(fold_spans);
+
     // If virtual_log_n >= log_n, pad the fold commitments with dummy group elements [1]_1.
     for (size_t l = 0; l < virtual_log_n - 1; l++) {
         std::string label = "Gemini:FOLD_" + std::to_string(l + 1);
         if (l < log_n - 1) {
-            transcript->send_to_verifier(label, commitment_key.commit(fold_polynomials[l]));
+            transcript->send_to_verifier(label, fold_commitments[l]);
         } else {
             transcript->send_to_verifier(label, Commitment::one());
         }
@@ -281,4 +281,42 @@ TYPED_TEST(CommitmentKeyTest, CommitStructuredNonzeroComplement)
     EXPECT_EQ(result, expected_result);
 }
 
+/**
+ * @brief Test that batch_commit agrees with committing to each polynomial separately, for polynomials of varied sizes,
+ * start indices and sparsity, including an empty one.
+ *
+ */
+TYPED_TEST(CommitmentKeyTest, BatchCommit)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 4096;
+
+    std::vector<Polynomial> polynomials;
+    polynomials.emplace_back(Polynomial::random(num_points));
+    polynomials.emplace_back(Polynomial::random(7, num_points, 3)); // small enough for the single-mul path
+    polynomials.emplace_back(Polynomial::random(1392, num_points, 1402));
+    polynomials.emplace_back(0, num_points);
+    // Sparse: a few nonzero entries in a zero polynomial
+    Polynomial& sparse = polynomials.emplace_back(num_points, num_points);
+    for (size_t i = 0; i < num_points; i += 97) {
+        sparse.at(i) = Fr::random_element();
+    }
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    std::vector<G1> expected;
+    for (auto& polynomial : polynomials) {
+        expected.emplace_back(key.commit(polynomial));
+    }
+    std::vector<G1> result = key.batch_commit(RefVector<Polynomial>(polynomials));
+
+    EXPECT_EQ(result, expected);
+    // The scalars are restored to Montgomery form, so committing again gives the same results.
+    EXPECT_EQ(key.batch_commit(RefVector<Polynomial>(polynomials)), expected);
+}
+
 } // namespace bb
@@ -0,0 +1,200 @@
+#ifndef NO_MULTITHREADING
+#include "barretenberg/common/compiler_hints.hpp"
+#include "thread.hpp"
+#include "work_stealing.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+// Index of the deque owned by the current thread, or EXTERNAL_QUEUE for threads the scheduler did not create.
+constexpr size_t EXTERNAL_QUEUE = std::numeric_limits<size_t>::max();
+thread_local size_t local_queue_index = EXTERNAL_QUEUE; // NOLINT
+} // namespace
+
+namespace bb {
+
+struct WorkStealingScheduler::Impl {
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    // One deque per worker, plus a shared one (the last) for external threads.
+    std::vector<std::unique_ptr<TaskQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> num_pending = 0;
+    std::atomic<size_t> num_sleeping = 0;
+    // Threads sleeping in help_until. They are woken whenever a task completes, as that may be what they wait for.
+    std::atomic<size_t> num_waiting = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable wake_condition;
+    std::atomic_bool stop = false;
+
+    size_t own_queue() const { return local_queue_index == EXTERNAL_QUEUE ? queues.size() - 1 : local_queue_index; }
+
+    bool pop_back(size_t queue_index, std::function<void()>& task)
+    {
+        auto& queue = *queues[queue_index];
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        num_pending.fetch_sub(1);
+        return true;
+    }
+
+    bool steal_front(size_t queue_index, std::function<void()>& task)
+    {
+        auto& queue = *queues[queue_index];
+        std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || queue.tasks.empty()) {
+            return false;
+        }
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        num_pending.fetch_sub(1);
+        return true;
+    }
+
+    bool run_one()
+    {
+        std::function<void()> task;
+        const size_t self = own_queue();
+        bool found = pop_back(self, task);
+        for (size_t offset = 1; !found && offset < queues.size(); ++offset) {
+            found = steal_front((self + offset) % queues.size(), task);
+        }
+        if (!found) {
+            return false;
+        }
+        task();
+        // Pairs with the fence in WorkStealingScheduler::wait: either the waiter sees the task's effects when it checks
+        // its predicate, or we see it waiting and wake it.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (num_waiting > 0) {
+            {
+                std::unique_lock<std::mutex> lock(sleep_mutex);
+            }
+            wake_condition.notify_all();
+        }
+        return true;
+    }
+
+    BB_NO_PROFILE void worker_loop(size_t worker_index)
+    {
+        local_queue_index = worker_index;
+        while (!stop) {
+            if (run_one()) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            num_sleeping++;
+            // A steal can fail on a contended lock, so only sleep if there really is nothing queued.
+            wake_condition.wait(lock, [this] { return num_pending > 0 || stop; });
+            num_sleeping--;
+        }
+    }
+};
+
+WorkStealingScheduler::WorkStealingScheduler(size_t num_workers)
+    : impl_(std::make_unique<Impl>())
+{
+    for (size_t i = 0; i < num_workers + 1; ++i) {
+        impl_->queues.emplace_back(std::make_unique<Impl::TaskQueue>());
+    }
+    impl_->workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        impl_->workers.emplace_back(&Impl::worker_loop, impl_.get(), i);
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    {
+        std::unique_lock<std::mutex> lock(impl_->sleep_mutex);
+        impl_->stop = true;
+    }
+    impl_->wake_condition.notify_all();
+    for (auto& worker : impl_->workers) {
+        worker.join();
+    }
+}
+
+WorkStealingScheduler& WorkStealingScheduler::get()
+{
+    static WorkStealingScheduler scheduler(get_num_cpus() - 1);
+    return scheduler;
+}
+
+void WorkStealingScheduler::submit(std::function<void()> task)
+{
+    {
+        auto& queue = *impl_->queues[impl_->own_queue()];
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    impl_->num_pending++;
+    // Pairs with the num_sleeping increment in worker_loop: either the worker sees our task before it sleeps, or we
+    // see it sleeping and wake it. Taking the lock ensures it is already waiting when we notify.
+    if (impl_->num_sleeping > 0) {
+        std::unique_lock<std::mutex> lock(impl_->sleep_mutex);
+    }
+    impl_->wake_condition.notify_one();
+}
+
+bool WorkStealingScheduler::run_one()
+{
+    return impl_->run_one();
+}
+
+void WorkStealingScheduler::wait(const std::function<bool()>& done)
+{
+    std::unique_lock<std::mutex> lock(impl_->sleep_mutex);
+    impl_->num_sleeping++;
+    impl_->num_waiting++;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    impl_->wake_condition.wait(lock, [this, &done] { return impl_->num_pending > 0 || done(); });
+    impl_->num_waiting--;
+    impl_->num_sleeping--;
+}
+
+size_t WorkStealingScheduler::num_workers() const
+{
+    return impl_->workers.size();
+}
+
+/**
+ * A work-stealing strategy. Every iteration becomes a task on the calling thread's deque; idle workers steal them, and
+ * the calling thread executes iterations itself until all are done. Because waiting threads keep executing tasks,
+ * parallel_for may be called from inside a parallel_for iteration: the inner iterations are spread over whichever
+ * workers are idle, rather than aborting as parallel_for_mutex_pool does.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    if (num_iterations == 0) {
+        return;
+    }
+    auto& scheduler = WorkStealingScheduler::get();
+    std::atomic<size_t> remaining(num_iterations);
+    // Queue in reverse so that the calling thread, which pops from the back, walks the iterations in order while
+    // thieves take from the far end.
+    for (size_t i = num_iterations - 1; i > 0; --i) {
+        scheduler.submit([&func, &remaining, i]() {
+            func(i);
+            remaining.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+    func(0);
+    remaining.fetch_sub(1, std::memory_order_acq_rel);
+    scheduler.help_until([&remaining] { return remaining.load(std::memory_order_acquire) == 0; });
+}
+} // namespace bb
+#endif
@@ -34,6 +34,9 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: "work_stealing" (enable with -DWORK_STEALING_MULTITHREADING=ON) allows nested parallel_for calls and keeps
+ * cores busy when iterations have very different costs. Compare the backends with parallel_for_bench.
  */
 
 namespace bb {
@@ -69,6 +72,9 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+// Supports nested calls and evens out uneven iterations; see parallel_for_work_stealing.cpp.
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -78,6 +84,8 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
 #else
 #ifdef OMP_MULTITHREADING
     parallel_for_omp(num_iterations, func);
+#elif defined(WORK_STEALING_MULTITHREADING)
+    parallel_for_work_stealing(num_iterations, func);
 #else
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
@@ -107,13 +115,19 @@ void parallel_for_range(size_t num_points,
         func(0, num_points);
         return;
     }
-    // Get number of cpus we can split into
-    const size_t num_cpus = get_num_cpus();
+    // Get number of chunks we can split into. With work stealing, idle threads pick up the chunks left over by threads
+    // that got expensive ones, so splitting finer evens out uneven per-element costs.
+#ifdef WORK_STEALING_MULTITHREADING
+    constexpr size_t CHUNKS_PER_CPU = 4;
+#else
+    constexpr size_t CHUNKS_PER_CPU = 1;
+#endif
+    const size_t num_chunks = get_num_cpus() * CHUNKS_PER_CPU;
 
     // Compute the size of a single chunk
-    const size_t chunk_size = (num_points / num_cpus) + (num_points % num_cpus == 0 ? 0 : 1);
+    const size_t chunk_size = (num_points / num_chunks) + (num_points % num_chunks == 0 ? 0 : 1);
     // Parallelize over chunks
-    parallel_for(num_cpus, [num_points, chunk_size, &func](size_t chunk_index) {
+    parallel_for(num_chunks, [num_points, chunk_size, &func](size_t chunk_index) {
         // If num_points is small, sometimes we need fewer CPUs
         if (chunk_size * chunk_index > num_points) {
             return;
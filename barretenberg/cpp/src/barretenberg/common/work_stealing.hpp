@@ -0,0 +1,130 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace bb {
+
+#ifndef NO_MULTITHREADING
+/**
+ * @brief Process-wide work-stealing scheduler.
+ * @details Every worker owns a deque: it pushes and pops its own tasks at the back (LIFO, cache-friendly for nested
+ * splits) while idle workers steal from the front of other deques (FIFO, steals the largest remaining pieces). Threads
+ * that are not workers (e.g. the main thread) share one extra deque.
+ *
+ * A thread that waits for tasks to complete keeps executing pending tasks until the ones it waits on are done, and only
+ * sleeps when there is nothing left to run (see help_until). This is what makes nested parallel_for calls safe, unlike
+ * the pool-based backends.
+ */
+class WorkStealingScheduler {
+  public:
+    static WorkStealingScheduler& get();
+
+    WorkStealingScheduler(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler(WorkStealingScheduler&& other) = delete;
+    WorkStealingScheduler& operator=(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler& operator=(WorkStealingScheduler&& other) = delete;
+    ~WorkStealingScheduler();
+
+    /**
+     * @brief Queues a task on the calling thread's deque.
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief Runs one pending task, preferring the calling thread's own deque. Returns false if there was none.
+     */
+    bool run_one();
+
+    /**
+     * @brief Executes pending tasks until done() returns true.
+     * @details When no task is pending the calling thread sleeps until one is submitted or another thread finishes a
+     * task, so done() must become true as the result of a task completing.
+     */
+    template <typename Predicate> void help_until(const Predicate& done)
+    {
+        while (!done()) {
+            if (!run_one()) {
+                wait(done);
+            }
+        }
+    }
+
+    size_t num_workers() const;
+
+  private:
+    struct Impl;
+    /**
+     * @brief Sleeps until a task is pending or done() returns true.
+     */
+    void wait(const std::function<bool()>& done);
+    explicit WorkStealingScheduler(size_t num_workers);
+    std::unique_ptr<Impl> impl_;
+};
+
+#endif
+
+#if !defined(NO_MULTITHREADING) && defined(WORK_STEALING_MULTITHREADING)
+/**
+ * @brief Handle to the result of a task started with spawn(). Waiting on it from inside another task is safe: the
+ * waiting thread executes other pending tasks in the meantime.
+ */
+template <typename T> class TaskFuture {
+  public:
+    explicit TaskFuture(std::future<T> future)
+        : future_(std::move(future))
+    {}
+
+    bool is_ready() const { return future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }
+
+    T get()
+    {
+        WorkStealingScheduler::get().help_until([this] { return is_ready(); });
+        return future_.get();
+    }
+
+  private:
+    std::future<T> future_;
+};
+
+/**
+ * @brief Runs func asynchronously on the work-stealing scheduler. Exceptions are rethrown by TaskFuture::get().
+ */
+template <typename Func> auto spawn(Func&& func)
+{
+    using Result = std::invoke_result_t<std::decay_t<Func>>;
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+    TaskFuture<Result> future(task->get_future());
+    WorkStealingScheduler::get().submit([task]() { (*task)(); });
+    return future;
+}
+#else
+// Without the work-stealing backend parallel_for already has a thread pool, so rather than start a second one next to
+// it, spawn() runs the task on the calling thread.
+template <typename T> class TaskFuture {
+  public:
+    explicit TaskFuture(std::future<T> future)
+        : future_(std::move(future))
+    {}
+    bool is_ready() const { return true; }
+    T get() { return future_.get(); }
+
+  private:
+    std::future<T> future_;
+};
+
+template <typename Func> auto spawn(Func&& func)
+{
+    using Result = std::invoke_result_t<std::decay_t<Func>>;
+    std::packaged_task<Result()> task(std::forward<Func>(func));
+    TaskFuture<Result> future(task.get_future());
+    task();
+    return future;
+}
+#endif
+
+} // namespace bb
@@ -0,0 +1,107 @@
+#include "barretenberg/common/work_stealing.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#ifndef NO_MULTITHREADING
+namespace bb {
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+}
+#endif
+
+using namespace bb;
+
+#ifndef NO_MULTITHREADING
+TEST(WorkStealing, CoversEveryIteration)
+{
+    const size_t num_iterations = 1000;
+    std::vector<std::atomic<size_t>> counts(num_iterations);
+    parallel_for_work_stealing(num_iterations, [&](size_t i) { counts[i]++; });
+    for (size_t i = 0; i < num_iterations; ++i) {
+        EXPECT_EQ(counts[i], 1);
+    }
+}
+
+TEST(WorkStealing, NestedParallelFor)
+{
+    const size_t outer = 16;
+    const size_t inner = 64;
+    std::vector<std::atomic<size_t>> counts(outer * inner);
+    parallel_for_work_stealing(outer, [&](size_t i) {
+        parallel_for_work_stealing(inner, [&](size_t j) { counts[i * inner + j]++; });
+    });
+    for (auto& count : counts) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(WorkStealing, HelpUntilWakesOnSubmit)
+{
+    auto& scheduler = WorkStealingScheduler::get();
+    std::atomic_bool done = false;
+    // Nothing is queued yet, so help_until has to sleep until this thread's task arrives
+    std::thread submitter([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        scheduler.submit([&] { done = true; });
+    });
+    scheduler.help_until([&] { return done.load(); });
+    submitter.join();
+    EXPECT_TRUE(done);
+}
+
+TEST(WorkStealing, HelpUntilWakesOnTaskCompletion)
+{
+    auto& scheduler = WorkStealingScheduler::get();
+    if (scheduler.num_workers() == 0) {
+        GTEST_SKIP() << "needs a worker thread";
+    }
+    std::atomic_bool started = false;
+    std::atomic_bool done = false;
+    scheduler.submit([&] {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        done = true;
+    });
+    // Once a worker has taken the task there is nothing left to run, so help_until sleeps until the task completes
+    while (!started) {
+        std::this_thread::yield();
+    }
+    scheduler.help_until([&] { return done.load(); });
+    EXPECT_TRUE(done);
+}
+#endif
+
+TEST(WorkStealing, SpawnReturnsResults)
+{
+    std::vector<TaskFuture<size_t>> futures;
+    for (size_t i = 0; i < 32; ++i) {
+        futures.push_back(spawn([i]() {
+            // Tasks may wait on tasks of their own.
+            auto inner = spawn([i]() { return i * i; });
+            return inner.get() + 1;
+        }));
+    }
+    for (size_t i = 0; i < futures.size(); ++i) {
+        EXPECT_EQ(futures[i].get(), i * i + 1);
+    }
+}
+
+TEST(WorkStealing, SpawnPropagatesExceptions)
+{
+    auto future = spawn([]() -> int { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+#ifndef WORK_STEALING_MULTITHREADING
+TEST(WorkStealing, SpawnRunsInlineWithoutWorkStealingBackend)
+{
+    const auto caller = std::this_thread::get_id();
+    auto future = spawn([]() { return std::this_thread::get_id(); });
+    EXPECT_TRUE(future.is_ready());
+    EXPECT_EQ(future.get(), caller);
+}
+#endif
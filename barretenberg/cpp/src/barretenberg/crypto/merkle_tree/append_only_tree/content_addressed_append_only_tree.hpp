@@ -6,15 +6,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ostream>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -55,6 +60,7 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     using FindSiblingPathCallback = std::function<void(TypedResponse<FindLeafPathResponse>&)>;
     using GetLeafCallback = std::function<void(TypedResponse<GetLeafResponse>&)>;
     using CommitCallback = std::function<void(TypedResponse<CommitResponse>&)>;
+    using StageBlockCallback = EmptyResponseCallback;
     using RollbackCallback = EmptyResponseCallback;
     using RemoveHistoricBlockCallback = std::function<void(TypedResponse<RemoveHistoricResponse>&)>;
     using UnwindBlockCallback = std::function<void(TypedResponse<UnwindResponse>&)>;
@@ -235,6 +241,11 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
      */
     void commit(const CommitCallback& on_completion);
 
+    /**
+     * @brief Records the current uncommitted state as a block, to be written to the backing store by the next commit
+     */
+    void stage_block(const StageBlockCallback& on_completion);
+
     /**
      * @brief Rollback the uncommitted changes
      */
@@ -245,6 +256,11 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
      */
     uint32_t depth() const { return depth_; }
 
+    /**
+     * @brief Synchronous method to retrieve an estimate of the memory held by the tree's uncommitted state
+     */
+    uint64_t get_cache_memory_usage() const { return store_->get_cache_memory_usage(); }
+
     void remove_historic_block(const block_number_t& blockNumber, const RemoveHistoricBlockCallback& on_completion);
 
     void unwind_block(const block_number_t& blockNumber, const UnwindBlockCallback& on_completion);
@@ -289,6 +305,15 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     void add_batch_internal(
         std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx);
 
+    void hash_subtree(std::span<fr> hashes, uint32_t level, const index_t& index);
+
+    void execute_on_workers(size_t num_jobs, const std::function<void(size_t)>& job);
+
+    static std::vector<fr> get_zero_hashes(uint32_t depth, const fr& zero_leaf);
+
+    // Appended subtrees are hashed concurrently on the thread pool in chunks of at least this many leaves
+    static constexpr uint32_t MIN_APPEND_CHUNK_SIZE = 128;
+
     std::unique_ptr<Store> store_;
     uint32_t depth_;
     uint64_t max_size_;
@@ -309,17 +334,8 @@ ContentAddressedAppendOnlyTree<Store, HashingPolicy>::ContentAddressedAppendOnly
     // start by reading the meta data from the backing store
     store_->get_meta(meta);
     depth_ = meta.depth;
-    zero_hashes_.resize(depth_ + 1);
-
-    // Create the zero hashes for the tree
-    auto current = HashingPolicy::zero_hash();
-    for (size_t i = depth_; i > 0; --i) {
-        // std::cout << "Zero hash at " << i << " : " << current << std::endl;
-        zero_hashes_[i] = current;
-        current = HashingPolicy::hash_pair(current, current);
-    }
-    zero_hashes_[0] = current;
-    // std::cout << "Zero root: " << current << std::endl;
+    zero_hashes_ = get_zero_hashes(depth_, HashingPolicy::zero_hash());
+    const fr current = zero_hashes_[0];
 
     max_size_ = numeric::pow64(2, depth_);
     // if root is non-zero it means the tree has already been initialized
@@ -938,6 +954,32 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_values_internal(
     workers_->enqueue(append_op);
 }
 
+/**
+ * @brief Returns the root of an empty subtree at every level of a tree of the given depth
+ * @details These are the same for every tree of the same depth, including every fork of a tree. They are computed once
+ * per process so that creating a tree, and so a fork, does not rehash them.
+ */
+template <typename Store, typename HashingPolicy>
+std::vector<fr> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_zero_hashes(uint32_t depth,
+                                                                                      const fr& zero_leaf)
+{
+    static std::mutex mutex;
+    static std::map<std::pair<uint32_t, uint256_t>, std::vector<fr>> computed;
+
+    std::unique_lock lock(mutex);
+    std::vector<fr>& zero_hashes = computed[{ depth, uint256_t(zero_leaf) }];
+    if (zero_hashes.empty()) {
+        zero_hashes.resize(depth + 1);
+        fr current = zero_leaf;
+        for (size_t i = depth; i > 0; --i) {
+            zero_hashes[i] = current;
+            current = HashingPolicy::hash_pair(current, current);
+        }
+        zero_hashes[0] = current;
+    }
+    return zero_hashes;
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::commit(const CommitCallback& on_completion)
 {
@@ -951,6 +993,13 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::commit(const CommitCa
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::stage_block(const StageBlockCallback& on_completion)
+{
+    auto job = [=, this]() { execute_and_report([=, this]() { store_->stage_block(); }, on_completion); };
+    workers_->enqueue(job);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::rollback(const RollbackCallback& on_completion)
 {
@@ -1120,14 +1169,6 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
             format("Unable to append leaves to tree ", meta.name, " new size: ", new_size, " max size: ", max_size_));
     }
 
-    // Add the values at the leaf nodes of the tree
-    for (uint32_t i = 0; i < number_to_insert; ++i) {
-        // write_node(level, index + i, hashes_local[i]);
-        // std::cout << "Writing leaf hash: " << hashes_local[i] << " level " << level << std::endl;
-        store_->put_node_by_hash(hashes_local[i], { .left = std::nullopt, .right = std::nullopt, .ref = 1 });
-        store_->put_cached_node_by_index(level, i + index, hashes_local[i]);
-    }
-
     // If we have been told to add these leaves to the index then do so now
     if (update_index) {
         for (uint32_t i = 0; i < number_to_insert; ++i) {
@@ -1140,25 +1181,30 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
         }
     }
 
-    // Hash the values as a sub tree and insert them
-    while (number_to_insert > 1) {
-        number_to_insert >>= 1;
-        index >>= 1;
-        --level;
-        // std::cout << "To INSERT " << number_to_insert << std::endl;
-        for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
-            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
-            store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
-            store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
-            // std::cout << "Writing node hash " << hashes_local[i] << " level " << level << " index " << index + i
-            //           << std::endl;
-        }
+    // Hash the values as a sub tree and insert them. Large batches are split into aligned chunks whose subtrees are
+    // hashed and written concurrently, then the roots of the chunks are hashed up to the root of the batch
+    uint32_t num_chunks = 1;
+    while (num_chunks * 2 <= workers_->num_threads() && number_to_insert / (num_chunks * 2) >= MIN_APPEND_CHUNK_SIZE) {
+        num_chunks *= 2;
     }
-
-    fr new_hash = hashes_local[0];
+    const uint32_t chunk_size = number_to_insert / num_chunks;
+    std::vector<fr> chunk_roots(num_chunks);
+    execute_on_workers(num_chunks, [&](size_t chunk) {
+        std::span<fr> chunk_hashes(hashes_local.data() + chunk * chunk_size, chunk_size);
+        const index_t chunk_index = index + chunk * chunk_size;
+        store_->put_nodes_at_level(level, chunk_index, chunk_hashes, {});
+        hash_subtree(chunk_hashes, level, chunk_index);
+        chunk_roots[chunk] = chunk_hashes[0];
+    });
+    const auto chunk_depth = static_cast<uint32_t>(numeric::get_msb(chunk_size));
+    level -= chunk_depth;
+    index >>= chunk_depth;
+    hash_subtree(chunk_roots, level, index);
+    const auto chunk_roots_depth = static_cast<uint32_t>(numeric::get_msb(num_chunks));
+    level -= chunk_roots_depth;
+    index >>= chunk_roots_depth;
+
+    fr new_hash = chunk_roots[0];
 
     // std::cout << "LEVEL: " << level << " hash " << new_hash << std::endl;
     RequestContext requestContext;
@@ -1201,4 +1247,79 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     store_->put_meta(meta);
 }
 
+/**
+ * @brief Hashes `hashes`, the nodes at `level` starting at `index`, up to the root of their subtree, which is left in
+ * hashes[0]. The number of nodes must be a power of 2. Each level of parents is written to the store in one batch.
+ */
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::hash_subtree(std::span<fr> hashes,
+                                                                        uint32_t level,
+                                                                        const index_t& index)
+{
+    size_t num_nodes = hashes.size();
+    index_t level_index = index;
+    // The parents are hashed into a separate buffer as the nodes need their children afterwards
+    std::vector<fr> parents(num_nodes / 2);
+    while (num_nodes > 1) {
+        num_nodes >>= 1;
+        level_index >>= 1;
+        --level;
+        std::span<fr> level_hashes(parents.data(), num_nodes);
+        HashingPolicy::hash_pairs(hashes.first(2 * num_nodes), level_hashes);
+        store_->put_nodes_at_level(level, level_index, level_hashes, hashes.first(2 * num_nodes));
+        std::copy(level_hashes.begin(), level_hashes.end(), hashes.begin());
+    }
+}
+
+/**
+ * @brief Runs job(0), ..., job(num_jobs - 1) concurrently on the thread pool and waits for all of them. Rethrows the
+ * first failure.
+ * @details This is called from within jobs on the same pool, so the calling thread claims jobs too and only waits for
+ * those already claimed by other threads. It never waits for a job that is still queued behind it.
+ */
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::execute_on_workers(size_t num_jobs,
+                                                                              const std::function<void(size_t)>& job)
+{
+    if (num_jobs == 1) {
+        job(0);
+        return;
+    }
+    struct Jobs {
+        std::atomic<size_t> next{ 0 };
+        std::atomic<size_t> remaining;
+        std::atomic_bool success{ true };
+        std::string message;
+    };
+    auto jobs = std::make_shared<Jobs>();
+    jobs->remaining = num_jobs;
+    // A helper that starts after every job has been claimed returns without calling `job`, which may be gone by then
+    auto run_jobs = [=, &job]() {
+        for (size_t i = jobs->next.fetch_add(1); i < num_jobs; i = jobs->next.fetch_add(1)) {
+            try {
+                job(i);
+            } catch (std::exception& e) {
+                if (jobs->success.exchange(false)) {
+                    jobs->message = e.what();
+                }
+            }
+            if (jobs->remaining.fetch_sub(1) == 1) {
+                jobs->remaining.notify_all();
+            }
+        }
+    };
+    for (size_t i = 1; i < num_jobs; ++i) {
+        workers_->enqueue(run_jobs);
+    }
+    run_jobs();
+    size_t remaining = jobs->remaining.load();
+    while (remaining != 0) {
+        jobs->remaining.wait(remaining);
+        remaining = jobs->remaining.load();
+    }
+    if (!jobs->success) {
+        throw std::runtime_error(jobs->message);
+    }
+}
+
 } // namespace bb::crypto::merkle_tree
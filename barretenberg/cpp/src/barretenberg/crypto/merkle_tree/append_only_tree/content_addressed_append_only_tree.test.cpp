@@ -772,6 +772,34 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_multiple_values_in_a
     check_sibling_path_by_value(tree, VALUES[4 - 1], memdb.get_sibling_path(4 - 1), 4 - 1);
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_large_batches_concurrently)
+{
+    // Large enough for the batches to be split into chunks hashed on several threads
+    constexpr size_t depth = 12;
+    constexpr uint32_t num_values = 1024 + 300;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(4);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    std::vector<fr> values = create_values(num_values);
+    for (size_t i = 0; i < num_values; ++i) {
+        memdb.update_element(i, values[i]);
+    }
+    add_values(tree, values);
+    check_size(tree, num_values);
+    check_root(tree, memdb.root());
+    commit_tree(tree);
+    check_root(tree, memdb.root(), false);
+
+    for (index_t i : { 0UL, 255UL, 256UL, 1023UL, 1024UL, 1279UL, 1280UL, num_values - 1UL }) {
+        check_leaf(tree, values[i], i, true, false);
+        check_sibling_path(tree, i, memdb.get_sibling_path(i), false);
+    }
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_pad_with_zero_leaves)
 {
     constexpr size_t depth = 10;
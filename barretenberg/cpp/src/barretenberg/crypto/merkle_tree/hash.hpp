@@ -14,6 +14,9 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -23,16 +26,39 @@ struct PedersenHashPolicy {
 
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    /**
+     * @brief Hashes consecutive pairs of `input`, i.e. output[i] = hash_pair(input[2i], input[2i + 1])
+     * @details `output` may alias the start of `input`.
+     */
+    static void hash_pairs(std::span<const fr> input, std::span<fr> output)
+    {
+        for (size_t i = 0; i < output.size(); ++i) {
+            output[i] = hash_pair(input[2 * i], input[(2 * i) + 1]);
+        }
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
 struct Poseidon2HashPolicy {
-    static fr hash(const std::vector<fr>& inputs)
+    using Poseidon2 = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    static fr hash(const std::vector<fr>& inputs) { return Poseidon2::hash(inputs); }
+
+    static fr hash_pair(const fr& lhs, const fr& rhs)
     {
-        return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash(inputs);
+        const std::array<fr, 2> input{ lhs, rhs };
+        fr output;
+        Poseidon2::hash_pairs(input, std::span(&output, 1));
+        return output;
     }
 
-    static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
+    /**
+     * @brief Hashes consecutive pairs of `input`, i.e. output[i] = hash_pair(input[2i], input[2i + 1])
+     * @details Interleaves several permutations and does not allocate, see Poseidon2::hash_pairs. `output` may alias
+     * the start of `input`.
+     */
+    static void hash_pairs(std::span<const fr> input, std::span<fr> output) { Poseidon2::hash_pairs(input, output); }
 
     static fr zero_hash() { return fr::zero(); }
 };
@@ -53,38 +79,36 @@ inline bb::fr hash_native(std::vector<bb::fr> const& inputs)
  * @param input: vector of leaf values.
  * @returns root as field
  */
+template <typename HashingPolicy = PedersenHashPolicy>
 inline bb::fr compute_tree_root_native(std::vector<bb::fr> const& input)
 {
     // Check if the input vector size is a power of 2.
     BB_ASSERT_GT(input.size(), static_cast<size_t>(0));
     ASSERT(numeric::is_power_of_two(input.size()));
+    // Each layer is hashed in place into the front of the buffer
     auto layer = input;
-    while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-        }
-        layer = std::move(next_layer);
+    for (size_t layer_size = layer.size() / 2; layer_size > 0; layer_size /= 2) {
+        HashingPolicy::hash_pairs(std::span(layer).subspan(0, 2 * layer_size), std::span(layer).subspan(0, layer_size));
     }
 
     return layer[0];
 }
 
 // TODO write test
+template <typename HashingPolicy = PedersenHashPolicy>
 inline std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input)
 {
     // Check if the input vector size is a power of 2.
     BB_ASSERT_GT(input.size(), static_cast<size_t>(0));
     ASSERT(numeric::is_power_of_two(input.size()));
-    auto layer = input;
-    std::vector<bb::fr> tree(input);
-    while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-            tree.push_back(next_layer[i]);
-        }
-        layer = std::move(next_layer);
+    // The tree holds all layers one after the other, leaves first; each layer is hashed from the previous one
+    std::vector<bb::fr> tree(2 * input.size() - 1);
+    std::copy(input.begin(), input.end(), tree.begin());
+    size_t layer_start = 0;
+    for (size_t layer_size = input.size(); layer_size > 1; layer_size /= 2) {
+        HashingPolicy::hash_pairs(std::span(tree).subspan(layer_start, layer_size),
+                                  std::span(tree).subspan(layer_start + layer_size, layer_size / 2));
+        layer_start += layer_size;
     }
 
     return tree;
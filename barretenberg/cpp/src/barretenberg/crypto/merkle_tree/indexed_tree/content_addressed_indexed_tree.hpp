@@ -196,6 +196,10 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
 
     void sparse_batch_update(const std::vector<std::pair<index_t, fr>>& hashes_at_level, uint32_t level);
 
+    fr sparse_batch_update_level(std::vector<index_t>& indices,
+                                 std::unordered_map<index_t, fr>& hashes,
+                                 uint32_t level);
+
     /**
      * @brief Adds or updates the given set of values in the tree
      * @param values The values to be added or updated
@@ -273,6 +277,7 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
 
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::store_;
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::zero_hashes_;
+    using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_zero_hashes;
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::depth_;
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::workers_;
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::max_size_;
@@ -292,15 +297,7 @@ ContentAddressedIndexedTree<Store, HashingPolicy>::ContentAddressedIndexedTree(
     if (prefilled_values.size() > initial_size) {
         throw std::runtime_error("Number of prefilled values can't be more than initial size");
     }
-    zero_hashes_.resize(depth_ + 1);
-
-    // Create the zero hashes for the tree
-    auto current = fr::zero();
-    for (uint32_t i = depth_; i > 0; --i) {
-        zero_hashes_[i] = current;
-        current = HashingPolicy::hash_pair(current, current);
-    }
-    zero_hashes_[0] = current;
+    zero_hashes_ = get_zero_hashes(depth_, fr::zero());
 
     TreeMeta meta;
     store_->get_meta(meta);
@@ -1159,13 +1156,6 @@ template <typename Store, typename HashingPolicy>
 void ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
     const std::vector<std::pair<index_t, fr>>& hashes_at_level, uint32_t level)
 {
-    auto get_optional_node = [&](uint32_t level, index_t index) -> std::optional<fr> {
-        fr value = fr::zero();
-
-        bool success = store_->get_cached_node_by_index(level, index, value);
-        // std::cout << "Getting node at " << level << " : " << index << " success " << success << std::endl;
-        return success ? std::optional<fr>(value) : std::nullopt;
-    };
     std::vector<index_t> indices;
     indices.reserve(hashes_at_level.size());
     std::unordered_map<index_t, fr> hashes;
@@ -1177,50 +1167,82 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
         indices.push_back(index);
         // std::cout << "index " << index << " hash " << hash << std::endl;
     }
-    std::unordered_set<index_t> unique_indices;
+    // None of the batches wrote anything, so nothing above them changes
+    if (indices.empty()) {
+        return;
+    }
     while (level > 0) {
-        std::vector<index_t> next_indices;
-        std::unordered_map<index_t, fr> next_hashes;
-        for (index_t index : indices) {
-            index_t parent_index = index >> 1;
-            auto it = unique_indices.insert(parent_index);
-            if (!it.second) {
-                continue;
-            }
-            next_indices.push_back(parent_index);
-            bool is_right = static_cast<bool>(index & 0x01);
-            fr new_hash = hashes[index];
-            std::optional<fr> new_right_option = is_right ? new_hash : get_optional_node(level, index + 1);
-            std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
-            fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
-            fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
-
-            new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-            store_->put_cached_node_by_index(level - 1, parent_index, new_hash);
-            store_->put_node_by_hash(new_hash, { .left = new_left_option, .right = new_right_option, .ref = 1 });
-            next_hashes[parent_index] = new_hash;
-        }
-        indices = std::move(next_indices);
-        hashes = std::move(next_hashes);
-        unique_indices.clear();
+        sparse_batch_update_level(indices, hashes, level);
         --level;
     }
 }
 
+/**
+ * @brief Computes the parents of the given nodes at `level`, writes them at `level - 1` and replaces `indices` and
+ * `hashes` with the parents. Siblings are read from the store, which already holds the nodes at `level`.
+ * @details All parents of the level are hashed in one HashingPolicy::hash_pairs batch.
+ * @returns The hash of the last parent
+ */
 template <typename Store, typename HashingPolicy>
-std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
-    const index_t& start_index,
-    const index_t& num_leaves_to_be_inserted,
-    const uint32_t& root_level,
-    const std::vector<LeafUpdate>& updates)
+fr ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update_level(std::vector<index_t>& indices,
+                                                                                std::unordered_map<index_t, fr>& hashes,
+                                                                                uint32_t level)
 {
+    // Callers stop before an empty level, there would be no last parent to return
+    assert(!indices.empty());
+
     auto get_optional_node = [&](uint32_t level, index_t index) -> std::optional<fr> {
         fr value = fr::zero();
-        // std::cout << "Getting node at " << level << " : " << index << std::endl;
         bool success = store_->get_cached_node_by_index(level, index, value);
         return success ? std::optional<fr>(value) : std::nullopt;
     };
 
+    // Collect the children of every distinct parent: (left, right) options and their values, interleaved
+    std::vector<index_t> next_indices;
+    std::vector<std::optional<fr>> children;
+    std::vector<fr> children_values;
+    next_indices.reserve(indices.size());
+    children.reserve(2 * indices.size());
+    children_values.reserve(2 * indices.size());
+    std::unordered_set<index_t> unique_indices;
+    for (index_t index : indices) {
+        index_t parent_index = index >> 1;
+        auto it = unique_indices.insert(parent_index);
+        if (!it.second) {
+            continue;
+        }
+        next_indices.push_back(parent_index);
+        bool is_right = static_cast<bool>(index & 0x01);
+        fr new_hash = hashes[index];
+        std::optional<fr> new_right_option = is_right ? new_hash : get_optional_node(level, index + 1);
+        std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
+        children_values.push_back(new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level]);
+        children_values.push_back(new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level]);
+        children.push_back(std::move(new_left_option));
+        children.push_back(std::move(new_right_option));
+    }
+
+    std::vector<fr> parents(next_indices.size());
+    HashingPolicy::hash_pairs(children_values, parents);
+
+    std::unordered_map<index_t, fr> next_hashes;
+    for (size_t i = 0; i < next_indices.size(); ++i) {
+        store_->put_cached_node_by_index(level - 1, next_indices[i], parents[i]);
+        store_->put_node_by_hash(parents[i], { .left = children[2 * i], .right = children[(2 * i) + 1], .ref = 1 });
+        next_hashes[next_indices[i]] = parents[i];
+    }
+    indices = std::move(next_indices);
+    hashes = std::move(next_hashes);
+    return parents.back();
+}
+
+template <typename Store, typename HashingPolicy>
+std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
+    const index_t& start_index,
+    const index_t& num_leaves_to_be_inserted,
+    const uint32_t& root_level,
+    const std::vector<LeafUpdate>& updates)
+{
     uint32_t level = depth_;
 
     std::vector<index_t> indices;
@@ -1228,7 +1250,6 @@ std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_ba
 
     fr new_hash = fr::zero();
 
-    std::unordered_set<index_t> unique_indices;
     std::unordered_map<index_t, fr> hashes;
     index_t end_index = start_index + num_leaves_to_be_inserted;
     // Insert the leaves
@@ -1262,32 +1283,7 @@ std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_ba
     }
 
     while (level > root_level) {
-        std::vector<index_t> next_indices;
-        std::unordered_map<index_t, fr> next_hashes;
-        for (index_t index : indices) {
-            index_t parent_index = index >> 1;
-            auto it = unique_indices.insert(parent_index);
-            if (!it.second) {
-                continue;
-            }
-            next_indices.push_back(parent_index);
-            bool is_right = static_cast<bool>(index & 0x01);
-            new_hash = hashes[index];
-            std::optional<fr> new_right_option = is_right ? new_hash : get_optional_node(level, index + 1);
-            std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
-            fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
-            fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
-
-            new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-            store_->put_cached_node_by_index(level - 1, parent_index, new_hash);
-            store_->put_node_by_hash(new_hash, { .left = new_left_option, .right = new_right_option, .ref = 1 });
-            next_hashes[parent_index] = new_hash;
-            // std::cout << "Created parent hash at level " << level - 1 << " index " << parent_index << " hash "
-            //           << new_hash << " left " << new_left_value << " right " << new_right_value << std::endl;
-        }
-        indices = std::move(next_indices);
-        hashes = std::move(next_hashes);
-        unique_indices.clear();
+        new_hash = sparse_batch_update_level(indices, hashes, level);
         --level;
     }
     // std::cout << "Returning hash " << new_hash << std::endl;
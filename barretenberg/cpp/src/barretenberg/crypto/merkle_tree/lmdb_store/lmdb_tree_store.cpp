@@ -54,6 +54,92 @@ int index_key_cmp(const MDB_val* a, const MDB_val* b)
     return value_cmp<uint64_t>(a, b);
 }
 
+namespace {
+void write_u64(uint8_t* p, uint64_t value)
+{
+    for (size_t i = 0; i < 8; ++i) {
+        p[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+uint64_t read_u64(const uint8_t* p)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        value |= static_cast<uint64_t>(p[i]) << (8 * i);
+    }
+    return value;
+}
+
+// Field elements are stored like the keys, as the limbs of their canonical value
+void write_fr(uint8_t* p, const fr& value)
+{
+    uint256_t canonical(value);
+    std::memcpy(p, canonical.data, 32);
+}
+
+fr read_fr(const uint8_t* p)
+{
+    uint256_t canonical;
+    std::memcpy(canonical.data, p, 32);
+    return fr(canonical);
+}
+
+void check_encoding(const MDB_val& data, size_t encodedSize, const char* payloadName)
+{
+    if (data.mv_size != encodedSize || *static_cast<const uint8_t*>(data.mv_data) != PAYLOAD_ENCODING_VERSION) {
+        throw std::runtime_error(format("Unexpected encoding of a stored ",
+                                        payloadName,
+                                        " payload of size ",
+                                        data.mv_size,
+                                        ", the database was written by an incompatible version and must be rebuilt"));
+    }
+}
+} // namespace
+
+void encode_node_payload(const NodePayload& payload, std::vector<uint8_t>& buffer)
+{
+    buffer.assign(NODE_PAYLOAD_ENCODED_SIZE, 0);
+    uint8_t* p = buffer.data();
+    p[0] = PAYLOAD_ENCODING_VERSION;
+    p[1] = static_cast<uint8_t>((payload.left.has_value() ? 1 : 0) | (payload.right.has_value() ? 2 : 0));
+    write_u64(p + 2, payload.ref);
+    if (payload.left.has_value()) {
+        write_fr(p + 10, payload.left.value());
+    }
+    if (payload.right.has_value()) {
+        write_fr(p + 42, payload.right.value());
+    }
+}
+
+void decode_node_payload(const MDB_val& data, NodePayload& payload)
+{
+    check_encoding(data, NODE_PAYLOAD_ENCODED_SIZE, "node");
+    const auto* p = static_cast<const uint8_t*>(data.mv_data);
+    payload.ref = read_u64(p + 2);
+    payload.left = (p[1] & 1) != 0 ? std::optional<fr>(read_fr(p + 10)) : std::nullopt;
+    payload.right = (p[1] & 2) != 0 ? std::optional<fr>(read_fr(p + 42)) : std::nullopt;
+}
+
+void encode_block_payload(const BlockPayload& payload, std::vector<uint8_t>& buffer)
+{
+    buffer.assign(BLOCK_PAYLOAD_ENCODED_SIZE, 0);
+    uint8_t* p = buffer.data();
+    p[0] = PAYLOAD_ENCODING_VERSION;
+    write_u64(p + 1, payload.size);
+    write_u64(p + 9, payload.blockNumber);
+    write_fr(p + 17, payload.root);
+}
+
+void decode_block_payload(const MDB_val& data, BlockPayload& payload)
+{
+    check_encoding(data, BLOCK_PAYLOAD_ENCODED_SIZE, "block");
+    const auto* p = static_cast<const uint8_t*>(data.mv_data);
+    payload.size = read_u64(p + 1);
+    payload.blockNumber = static_cast<block_number_t>(read_u64(p + 9));
+    payload.root = read_fr(p + 17);
+}
+
 LMDBTreeStore::LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders)
     : LMDBStoreBase(directory, mapSizeKb, maxNumReaders, 5)
     , _name(std::move(name))
@@ -115,9 +201,8 @@ void LMDBTreeStore::write_block_data(const block_number_t& blockNumber,
                                      const BlockPayload& blockData,
                                      LMDBTreeStore::WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, blockData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded;
+    encode_block_payload(blockData, encoded);
     BlockMetaKeyType key(blockNumber);
     tx.put_value<BlockMetaKeyType>(key, encoded, *_blockDatabase);
 }
@@ -133,10 +218,10 @@ bool LMDBTreeStore::read_block_data(const block_number_t& blockNumber,
                                     LMDBTreeStore::ReadTransaction& tx)
 {
     BlockMetaKeyType key(blockNumber);
-    std::vector<uint8_t> data;
+    MDB_val data;
     bool success = tx.get_value<BlockMetaKeyType>(key, data, *_blockDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(blockData);
+        decode_block_payload(data, blockData);
     }
     return success;
 }
@@ -226,10 +311,10 @@ void LMDBTreeStore::write_meta_data(const TreeMeta& metaData, LMDBTreeStore::Wri
 bool LMDBTreeStore::read_meta_data(TreeMeta& metaData, LMDBTreeStore::ReadTransaction& tx)
 {
     MetaKeyType key(0);
-    std::vector<uint8_t> data;
+    MDB_val data;
     bool success = tx.get_value<MetaKeyType>(key, data, *_blockDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(metaData);
+        msgpack::unpack(static_cast<const char*>(data.mv_data), data.mv_size).get().convert(metaData);
     }
     return success;
 }
@@ -315,20 +400,13 @@ fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
 
 bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
 {
-    FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
-    bool success = tx.get_value<FrKeyType>(key, data, *_nodeDatabase);
-    if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
-    }
-    return success;
+    return get_node_data(nodeHash, nodeData, tx);
 }
 
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, nodeData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded;
+    encode_node_payload(nodeData, encoded);
     FrKeyType key(nodeHash);
     tx.put_value<FrKeyType>(key, encoded, *_nodeDatabase);
 }
@@ -19,6 +19,7 @@
 #include "barretenberg/serialize/msgpack_impl.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include "lmdb.h"
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <ostream>
@@ -27,6 +28,7 @@
 #include <typeinfo>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace bb::crypto::merkle_tree {
 
@@ -159,6 +161,23 @@ struct BlockIndexPayload {
         blockNumbers[1] = blockNumber;
     }
 };
+
+/**
+ * Node and block payloads are stored with a fixed width binary encoding, so that they can be decoded straight out of
+ * the LMDB value. The first byte holds the version of the encoding. Records in any other encoding (such as the msgpack
+ * maps written before this encoding existed) are rejected when read; databases holding them must be rebuilt.
+ */
+constexpr uint8_t PAYLOAD_ENCODING_VERSION = 1;
+// version, flags (bit 0: left is present, bit 1: right is present), ref, left, right
+constexpr size_t NODE_PAYLOAD_ENCODED_SIZE = 1 + 1 + 8 + 32 + 32;
+// version, size, block number, root
+constexpr size_t BLOCK_PAYLOAD_ENCODED_SIZE = 1 + 8 + 8 + 32;
+
+void encode_node_payload(const NodePayload& payload, std::vector<uint8_t>& buffer);
+void decode_node_payload(const MDB_val& data, NodePayload& payload);
+void encode_block_payload(const BlockPayload& payload, std::vector<uint8_t>& buffer);
+void decode_block_payload(const MDB_val& data, BlockPayload& payload);
+
 /**
  * Creates an abstraction against a collection of LMDB databases within a single environment used to store merkle tree
  * data
@@ -259,10 +278,10 @@ template <typename LeafType, typename TxType>
 bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx)
 {
     FrKeyType key(leafHash);
-    std::vector<uint8_t> data;
+    MDB_val data;
     bool success = tx.template get_value<FrKeyType>(key, data, *_leafHashToPreImageDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(leafData);
+        msgpack::unpack(static_cast<const char*>(data.mv_data), data.mv_size).get().convert(leafData);
     }
     return success;
 }
@@ -280,10 +299,10 @@ void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafD
 template <typename TxType> bool LMDBTreeStore::get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx)
 {
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
+    MDB_val data;
     bool success = tx.template get_value<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        decode_node_payload(data, nodeData);
     }
     return success;
 }
@@ -275,6 +275,56 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_nodes)
     }
 }
 
+TEST_F(LMDBTreeStoreTest, can_write_and_read_leaf_nodes)
+{
+    // Nodes without children, and with a reference count that needs all 8 bytes
+    NodePayload nodePayload{ .left = std::nullopt, .right = std::nullopt, .ref = 0x0102030405060708 };
+    NodePayload halfNodePayload{ .left = VALUES[1], .right = std::nullopt, .ref = 1 };
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_node(VALUES[2], nodePayload, *transaction);
+        store.write_node(VALUES[3], halfNodePayload, *transaction);
+        transaction->commit();
+    }
+
+    {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        NodePayload readBack{ .left = VALUES[0], .right = VALUES[0], .ref = 0 };
+        EXPECT_TRUE(store.read_node(VALUES[2], readBack, *transaction));
+        EXPECT_EQ(readBack, nodePayload);
+        EXPECT_TRUE(store.read_node(VALUES[3], readBack, *transaction));
+        EXPECT_EQ(readBack, halfNodePayload);
+    }
+}
+
+TEST_F(LMDBTreeStoreTest, rejects_legacy_payload_encoding)
+{
+    NodePayload nodePayload{ .left = VALUES[4], .right = std::nullopt, .ref = 7 };
+    BlockPayload blockPayload{ .size = 45, .blockNumber = 3, .root = VALUES[0] };
+
+    // Payloads written before the binary encoding were msgpack maps
+    msgpack::sbuffer nodeBuffer;
+    msgpack::pack(nodeBuffer, nodePayload);
+    MDB_val nodeData{ .mv_size = nodeBuffer.size(), .mv_data = nodeBuffer.data() };
+    NodePayload nodeReadBack;
+    EXPECT_THROW(decode_node_payload(nodeData, nodeReadBack), std::runtime_error);
+
+    msgpack::sbuffer blockBuffer;
+    msgpack::pack(blockBuffer, blockPayload);
+    MDB_val blockData{ .mv_size = blockBuffer.size(), .mv_data = blockBuffer.data() };
+    BlockPayload blockReadBack;
+    EXPECT_THROW(decode_block_payload(blockData, blockReadBack), std::runtime_error);
+
+    // Right size, wrong version
+    std::vector<uint8_t> encoded;
+    encode_node_payload(nodePayload, encoded);
+    EXPECT_EQ(encoded.size(), NODE_PAYLOAD_ENCODED_SIZE);
+    encoded[0] = PAYLOAD_ENCODING_VERSION + 1;
+    MDB_val wrongVersion{ .mv_size = encoded.size(), .mv_data = encoded.data() };
+    EXPECT_THROW(decode_node_payload(wrongVersion, nodeReadBack), std::runtime_error);
+}
+
 TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
 {
     PublicDataLeafValue leafData;
@@ -24,6 +24,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <unordered_map>
@@ -106,6 +107,16 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
      */
     void put_cached_node_by_index(uint32_t level, const index_t& index, const fr& data, bool overwriteIfPresent = true);
 
+    /**
+     * @brief Writes a contiguous run of nodes at the given level under a single lock. Node i is written at index
+     * startIndex + i and by hash, with children children[2i] and children[2i + 1], or as a leaf if children is empty.
+     * Only writes to uncommitted data.
+     */
+    void put_nodes_at_level(uint32_t level,
+                            const index_t& startIndex,
+                            std::span<const fr> nodes,
+                            std::span<const fr> children);
+
     /**
      * @brief Returns the data at the given node coordinates if available.
      */
@@ -147,7 +158,14 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
                                                 ReadTransaction& tx) const;
 
     /**
-     * @brief Commits the uncommitted data to the underlying store
+     * @brief Records the current uncommitted state as a block, to be written by the next commit_block
+     * @details Staged blocks are persisted in order, ahead of the block being committed, within the same write
+     * transaction. This allows a number of blocks to be synched with a single commit.
+     */
+    void stage_block();
+
+    /**
+     * @brief Commits the uncommitted data to the underlying store, along with any staged blocks
      */
     void commit_block(TreeMeta& finalMeta, TreeDBStats& dbStats);
 
@@ -191,6 +209,15 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     std::optional<block_number_t> find_block_for_index(const index_t& index, ReadTransaction& tx) const;
 
+    /**
+     * @brief Returns an estimate of the memory held by the uncommitted state of the store
+     */
+    uint64_t get_cache_memory_usage() const
+    {
+        std::unique_lock lock(mtx_);
+        return cache_.memory_usage();
+    }
+
     void checkpoint();
     void revert_checkpoint();
     void commit_checkpoint();
@@ -212,6 +239,9 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     Cache cache_;
 
+    // Blocks recorded by stage_block and not yet committed, only accessed by the commit/rollback operations
+    std::vector<BlockPayload> stagedBlocks_;
+
     void initialise();
 
     void initialise_from_block(const block_number_t& blockNumber);
@@ -276,28 +306,34 @@ ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
 // These 3 apis (checkpoint/revert_checkpoint/commit_checkpoint) all assume they are not called
 // during the process of reading/writing uncommitted state
 // This is reasonable, they intended for use by forks at the point of starting/ending a function call
+// The lock is still taken, as get_cache_memory_usage can be called at any time
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::checkpoint()
 {
+    std::unique_lock lock(mtx_);
     cache_.checkpoint();
 }
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::revert_checkpoint()
 {
+    std::unique_lock lock(mtx_);
     cache_.revert();
 }
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::commit_checkpoint()
 {
+    std::unique_lock lock(mtx_);
     cache_.commit();
 }
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::revert_all_checkpoints()
 {
+    std::unique_lock lock(mtx_);
     cache_.revert_all();
 }
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::commit_all_checkpoints()
 {
+    std::unique_lock lock(mtx_);
     cache_.commit_all();
 }
 
@@ -544,6 +580,25 @@ void ContentAddressedCachedTreeStore<LeafValueType>::put_cached_node_by_index(ui
     cache_.put_node_by_index(level, index, data);
 }
 
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::put_nodes_at_level(uint32_t level,
+                                                                        const index_t& startIndex,
+                                                                        std::span<const fr> nodes,
+                                                                        std::span<const fr> children)
+{
+    // Accessing the cache under a lock
+    std::unique_lock lock(mtx_);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        NodePayload payload{ .left = std::nullopt, .right = std::nullopt, .ref = 1 };
+        if (!children.empty()) {
+            payload.left = children[i * 2];
+            payload.right = children[i * 2 + 1];
+        }
+        cache_.put_node(nodes[i], payload);
+        cache_.put_node_by_index(level, startIndex + i, nodes[i]);
+    }
+}
+
 template <typename LeafValueType>
 bool ContentAddressedCachedTreeStore<LeafValueType>::get_cached_node_by_index(uint32_t level,
                                                                               const index_t& index,
@@ -639,11 +694,10 @@ fr ContentAddressedCachedTreeStore<LeafValueType>::get_current_root(ReadTransact
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(WriteTransaction& tx)
 {
-    const std::map<uint256_t, index_t>& indices = cache_.get_indices();
-    for (const auto& idx : indices) {
+    cache_.get_indices().for_each([&](const SortedKeyIndex::Entry& idx) {
         FrKeyType key = idx.first;
         dataStore_->write_leaf_index(key, idx.second, tx);
-    }
+    });
 }
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::commit_genesis_state()
@@ -679,10 +733,21 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
     rollback();
 }
 
+template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::stage_block()
+{
+    // We don't allow commits using images/forks
+    if (forkConstantData_.initialised_from_block_.has_value()) {
+        throw std::runtime_error("Committing a fork is forbidden");
+    }
+    TreeMeta meta;
+    get_meta(meta);
+    // The block number is assigned when the block is committed
+    stagedBlocks_.push_back(BlockPayload{ .size = meta.size, .blockNumber = 0, .root = meta.root });
+}
+
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::commit_block(TreeMeta& finalMeta, TreeDBStats& dbStats)
 {
-    bool dataPresent = false;
     TreeMeta meta;
 
     // We don't allow commits using images/forks
@@ -690,33 +755,40 @@ void ContentAddressedCachedTreeStore<LeafValueType>::commit_block(TreeMeta& fina
         throw std::runtime_error("Committing a fork is forbidden");
     }
     get_meta(meta);
-    NodePayload rootPayload;
-    dataPresent = cache_.get_node(meta.root, rootPayload);
+    // Any staged blocks are written first, then the block for the current uncommitted state
+    std::vector<BlockPayload> blocks = stagedBlocks_;
+    blocks.push_back(BlockPayload{ .size = meta.size, .blockNumber = 0, .root = meta.root });
     {
         WriteTransactionPtr tx = create_write_transaction();
         try {
-            if (dataPresent) {
-                // std::cout << "Persisting data for block " << uncommittedMeta.unfinalisedBlockHeight + 1 << std::endl;
-                // Persist the leaf indices
-                persist_leaf_indices(*tx);
-            }
-            // If we are commiting a block, we need to persist the root, since the new block "references" this root
-            // However, if the root is the empty root we can't persist it, since it's not a real node and doesn't have
-            // nodes beneath it. We coujld store a 'dummy' node to represent it but then we have to work around the
-            // absence of a real tree elsewhere. So, if the tree is completely empty we do not store any node data, the
-            // only issue is this needs to be recognised when we unwind or remove historic blocks i.e. there will be no
-            // node date to remove for these blocks
-            if (dataPresent || meta.size > 0) {
-                persist_node(std::optional<fr>(meta.root), 0, *tx);
-            }
-            ++meta.unfinalisedBlockHeight;
-            if (meta.oldestHistoricBlock == 0) {
-                meta.oldestHistoricBlock = 1;
+            bool leafIndicesPersisted = false;
+            for (BlockPayload& block : blocks) {
+                NodePayload rootPayload;
+                bool dataPresent = cache_.get_node(block.root, rootPayload);
+                if (dataPresent && !leafIndicesPersisted) {
+                    // Persist the leaf indices, the cache holds those of every block being committed
+                    persist_leaf_indices(*tx);
+                    leafIndicesPersisted = true;
+                }
+                // If we are commiting a block, we need to persist the root, since the new block "references" this
+                // root. However, if the root is the empty root we can't persist it, since it's not a real node and
+                // doesn't have nodes beneath it. We could store a 'dummy' node to represent it but then we have to
+                // work around the absence of a real tree elsewhere. So, if the tree is completely empty we do not
+                // store any node data, the only issue is this needs to be recognised when we unwind or remove historic
+                // blocks i.e. there will be no node data to remove for these blocks.
+                // The transaction reads its own writes, so nodes shared with an earlier block in this commit have
+                // their reference counts incremented exactly as if the blocks had been committed separately.
+                if (dataPresent || block.size > 0) {
+                    persist_node(std::optional<fr>(block.root), 0, *tx);
+                }
+                ++meta.unfinalisedBlockHeight;
+                if (meta.oldestHistoricBlock == 0) {
+                    meta.oldestHistoricBlock = 1;
+                }
+                block.blockNumber = meta.unfinalisedBlockHeight;
+                dataStore_->write_block_data(block.blockNumber, block, *tx);
+                dataStore_->write_block_index_data(block.blockNumber, block.size, *tx);
             }
-            // std::cout << "New root " << uncommittedMeta.root << std::endl;
-            BlockPayload block{ .size = meta.size, .blockNumber = meta.unfinalisedBlockHeight, .root = meta.root };
-            dataStore_->write_block_data(meta.unfinalisedBlockHeight, block, *tx);
-            dataStore_->write_block_index_data(block.blockNumber, block.size, *tx);
 
             meta.committedSize = meta.size;
             persist_meta(meta, *tx);
@@ -808,13 +880,15 @@ void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::opt
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::rollback()
 {
     // Extract the committed meta data and destroy the cache
-    cache_.reset(forkConstantData_.depth_);
+    TreeMeta committedMeta;
     {
         ReadTransactionPtr tx = create_read_transaction();
-        TreeMeta committedMeta;
         read_persisted_meta(committedMeta, *tx);
-        cache_.put_meta(committedMeta);
     }
+    std::unique_lock lock(mtx_);
+    cache_.reset(forkConstantData_.depth_);
+    cache_.put_meta(committedMeta);
+    stagedBlocks_.clear();
 }
 
 template <typename LeafValueType>
@@ -5,7 +5,10 @@
 // =====================
 
 #pragma once
+#include "./sorted_key_index.hpp"
 #include "./tree_meta.hpp"
+#include "barretenberg/common/ankerl_dense.hpp"
+#include "barretenberg/common/log.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
@@ -14,6 +17,7 @@
 #include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "msgpack/assert.hpp"
+#include <algorithm>
 #include <cstdint>
 #include <exception>
 #include <iostream>
@@ -22,12 +26,14 @@
 #include <optional>
 #include <sstream>
 #include <stdexcept>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
 
+// Open addressing hash map, used for the node and pre-image tables as they see many small inserts and lookups
+template <class Key, class T> using flat_map = ::ankerl::unordered_dense::map<Key, T>;
+
 // Stores all of the penidng updates to a mekle tree indexed for optimal retrieval
 // Also stores a journal of inverse changes to the cache, enabling checkpoints and
 // and subsequent commit/revert operations
@@ -76,10 +82,15 @@ template <typename LeafValueType> class ContentAddressedCache {
     std::optional<fr> get_node_by_index(uint32_t level, const index_t& index) const;
     void put_node_by_index(uint32_t level, const index_t& index, const fr& node);
 
-    const std::map<uint256_t, index_t>& get_indices() const { return indices_; }
+    const SortedKeyIndex& get_indices() const { return indices_; }
 
     bool is_equivalent_to(const ContentAddressedCache& other) const;
 
+    /**
+     * @brief Returns an estimate of the heap memory held by the cache, including any checkpoint journals
+     */
+    uint64_t memory_usage() const;
+
   private:
     struct Journal {
         // Captures the tree's metadata at the time of checkpoint
@@ -87,38 +98,70 @@ template <typename LeafValueType> class ContentAddressedCache {
         // Captures the cache's node hashes at the time of checkpoint. If the node does not exist in the cache, the
         // optional will == nullopt
         // TODO (PhilWindle): Consider where a more optimal approach is a single unordered map, instead of 1 per level
-        std::vector<std::unordered_map<index_t, std::optional<fr>>> nodes_by_index_;
+        std::vector<flat_map<index_t, std::optional<fr>>> nodes_by_index_;
         // Captures the cache's leaf pre-images at the time of checkpoint. Again, if the leaf does not exist in the
         // cache, the optional will == nullopt
-        std::unordered_map<index_t, std::optional<IndexedLeafValueType>> leaf_pre_image_by_index_;
+        flat_map<index_t, std::optional<IndexedLeafValueType>> leaf_pre_image_by_index_;
         // Captures the addition of new leaf keys into the indices_ cache
         std::vector<uint256_t> new_leaf_keys_;
 
         Journal(TreeMeta meta)
             : meta_(std::move(meta))
-            , nodes_by_index_(meta_.depth + 1, std::unordered_map<index_t, std::optional<fr>>())
         {}
     };
     // This is a mapping between the node hash and it's payload (children and ref count) for every node in the tree,
     // including leaves. As indexed trees are updated, this will end up containing many nodes that are not part of the
     // final tree so they need to be omitted from what is committed.
-    std::unordered_map<fr, NodePayload> nodes_;
+    flat_map<fr, NodePayload> nodes_;
 
     // This is a store mapping the leaf key (e.g. slot for public data or nullifier value for nullifier tree) to the
-    // index in the tree
-    std::map<uint256_t, index_t> indices_;
+    // index in the tree, ordered by key for the low leaf searches
+    SortedKeyIndex indices_;
 
     // This is a mapping from leaf hash to leaf pre-image. This will contain entries that need to be omitted when
     // commiting updates
-    std::unordered_map<fr, IndexedLeafValueType> leaves_;
+    flat_map<fr, IndexedLeafValueType> leaves_;
     TreeMeta meta_;
 
+    // Nodes can be cached at levels 0 to depth_ inclusive
+    uint32_t depth_;
+
     // The following stores are not persisted, just cached until commit
-    std::vector<std::unordered_map<index_t, fr>> nodes_by_index_;
-    std::unordered_map<index_t, IndexedLeafValueType> leaf_pre_image_by_index_;
+    // There is a store per level of the tree, created on the first write to that level. An unmodified cache (e.g. that
+    // of a newly created fork) then holds no per level state.
+    std::vector<flat_map<index_t, fr>> nodes_by_index_;
+    flat_map<index_t, IndexedLeafValueType> leaf_pre_image_by_index_;
 
     // The currently active journals
     std::vector<Journal> journals_;
+
+    // Returns the store for the given level, creating it and those of any levels below it if necessary
+    template <typename Map> Map& get_or_create_level(std::vector<Map>& levels, uint32_t level)
+    {
+        if (level > depth_) {
+            throw std::runtime_error(format("Level ", level, " is beyond the depth of the tree: ", depth_));
+        }
+        if (levels.size() <= level) {
+            levels.resize(level + 1);
+        }
+        return levels[level];
+    }
+
+    // The entries of an unordered_dense map are held contiguously, alongside a separate array of buckets
+    template <typename Map> static uint64_t flat_map_memory_usage(const Map& map)
+    {
+        return (map.values().capacity() * sizeof(typename Map::value_type)) +
+               (map.bucket_count() * sizeof(typename Map::bucket_type));
+    }
+
+    template <typename Map> static uint64_t levels_memory_usage(const std::vector<Map>& levels)
+    {
+        uint64_t bytes = levels.capacity() * sizeof(Map);
+        for (const Map& level : levels) {
+            bytes += flat_map_memory_usage(level);
+        }
+        return bytes;
+    }
 };
 
 template <typename LeafValueType> ContentAddressedCache<LeafValueType>::ContentAddressedCache(uint32_t depth)
@@ -169,9 +212,7 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::rev
     }
 
     // Remove any newly added leaf keys
-    for (const auto& key : journal.new_leaf_keys_) {
-        indices_.erase(key);
-    }
+    indices_.erase(journal.new_leaf_keys_);
 
     // We need to restore the meta data
     meta_ = std::move(journal.meta_);
@@ -201,9 +242,10 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::com
             // There is an entry in the current journal, if it does not exist in the previous journal then we need to
             // add it If it does exist in the previous journal then that journal already captured a value from the
             // primary cache that existed no later
-            auto previousIter = previous_journal.nodes_by_index_[i].find(index);
-            if (previousIter == previous_journal.nodes_by_index_[i].end()) {
-                previous_journal.nodes_by_index_[i][index] = optional_node_hash;
+            auto& previous_level = get_or_create_level(previous_journal.nodes_by_index_, i);
+            auto previousIter = previous_level.find(index);
+            if (previousIter == previous_level.end()) {
+                previous_level[index] = optional_node_hash;
             }
         }
     }
@@ -242,11 +284,12 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::rev
 }
 template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::reset(uint32_t depth)
 {
-    nodes_ = std::unordered_map<fr, NodePayload>();
-    indices_ = std::map<uint256_t, index_t>();
-    leaves_ = std::unordered_map<fr, IndexedLeafValueType>();
-    nodes_by_index_ = std::vector<std::unordered_map<index_t, fr>>(depth + 1, std::unordered_map<index_t, fr>());
-    leaf_pre_image_by_index_ = std::unordered_map<index_t, IndexedLeafValueType>();
+    depth_ = depth;
+    nodes_ = flat_map<fr, NodePayload>();
+    indices_ = SortedKeyIndex();
+    leaves_ = flat_map<fr, IndexedLeafValueType>();
+    nodes_by_index_ = std::vector<flat_map<index_t, fr>>();
+    leaf_pre_image_by_index_ = flat_map<index_t, IndexedLeafValueType>();
     journals_ = std::vector<Journal>();
 }
 
@@ -263,9 +306,13 @@ bool ContentAddressedCache<LeafValueType>::is_equivalent_to(const ContentAddress
         return false;
     }
 
-    // Nodes by index should be identical
-    if (nodes_by_index_ != other.nodes_by_index_) {
-        return false;
+    // Nodes by index should be identical, levels that have not been written to are empty
+    for (size_t i = 0; i < std::max(nodes_by_index_.size(), other.nodes_by_index_.size()); ++i) {
+        const bool present = i < nodes_by_index_.size() && !nodes_by_index_[i].empty();
+        const bool other_present = i < other.nodes_by_index_.size() && !other.nodes_by_index_[i].empty();
+        if (present != other_present || (present && nodes_by_index_[i] != other.nodes_by_index_[i])) {
+            return false;
+        }
     }
 
     // Leaf pre-images by index should be identical
@@ -306,38 +353,25 @@ std::pair<bool, index_t> ContentAddressedCache<LeafValueType>::find_low_value(co
         return std::make_pair(new_leaf_key == retrieved_value, db_index);
     }
     // At this stage, we have been asked to include uncommitted and the value was not exactly found in the db
-    auto it = indices_.lower_bound(new_leaf_key);
-    if (it == indices_.end()) {
-        // there is no element >= the requested value.
-        // decrement the iterator to get the value preceeding the requested value
-        --it;
-        // we need to return the larger of the db value or the cached value
-
-        return std::make_pair(false, it->first > retrieved_value ? it->second : db_index);
-    }
-
-    if (it->first == new_leaf_key) {
-        // the value is already present and the iterator points to it
-        return std::make_pair(true, it->second);
-    }
-    // the iterator points to the element immediately larger than the requested value
-    // We need to return the highest value from
-    // 1. The next lowest cached value, if there is one
-    // 2. The value retrieved from the db
-    if (it == indices_.begin()) {
-        // No cached lower value, return the db index
+    std::optional<SortedKeyIndex::Entry> floor = indices_.find_floor(new_leaf_key);
+    if (!floor.has_value()) {
+        // No cached value <= the requested value, return the db index
         return std::make_pair(false, db_index);
     }
-    --it;
-    //  it now points to the value less than that requested
-    return std::make_pair(false, it->first > retrieved_value ? it->second : db_index);
+    if (floor->first == new_leaf_key) {
+        // the value is already present
+        return std::make_pair(true, floor->second);
+    }
+    // floor is the cached value immediately less than that requested
+    // We need to return the larger of the db value or the cached value
+    return std::make_pair(false, floor->first > retrieved_value ? floor->second : db_index);
 }
 
 template <typename LeafValueType>
 bool ContentAddressedCache<LeafValueType>::get_leaf_preimage_by_hash(const fr& leaf_hash,
                                                                      IndexedLeafValueType& leaf_pre_image) const
 {
-    typename std::unordered_map<fr, IndexedLeafValueType>::const_iterator it = leaves_.find(leaf_hash);
+    auto it = leaves_.find(leaf_hash);
     if (it != leaves_.end()) {
         leaf_pre_image = it->second;
         return true;
@@ -356,8 +390,7 @@ template <typename LeafValueType>
 bool ContentAddressedCache<LeafValueType>::get_leaf_by_index(const index_t& index,
                                                              IndexedLeafValueType& leaf_pre_image) const
 {
-    typename std::unordered_map<index_t, IndexedLeafValueType>::const_iterator it =
-        leaf_pre_image_by_index_.find(index);
+    auto it = leaf_pre_image_by_index_.find(index);
     if (it != leaf_pre_image_by_index_.end()) {
         leaf_pre_image = it->second;
         return true;
@@ -397,8 +430,7 @@ template <typename LeafValueType>
 void ContentAddressedCache<LeafValueType>::update_leaf_key_index(const index_t& index, const fr& leaf_key)
 {
     uint256_t key = uint256_t(leaf_key);
-    auto result = indices_.insert({ key, index });
-    if (result.second && !journals_.empty()) {
+    if (indices_.insert(key, index) && !journals_.empty()) {
         // The insertion took place, if we have a current journal then we need to add to the newly inserted leaf keys
         Journal& journal = journals_.back();
         journal.new_leaf_keys_.emplace_back(key);
@@ -408,11 +440,7 @@ void ContentAddressedCache<LeafValueType>::update_leaf_key_index(const index_t&
 template <typename LeafValueType>
 std::optional<index_t> ContentAddressedCache<LeafValueType>::get_leaf_key_index(const fr& leaf_key) const
 {
-    auto it = indices_.find(uint256_t(leaf_key));
-    if (it == indices_.end()) {
-        return std::nullopt;
-    }
-    return it->second;
+    return indices_.find(uint256_t(leaf_key));
 }
 
 template <typename LeafValueType>
@@ -435,6 +463,9 @@ bool ContentAddressedCache<LeafValueType>::get_node(const fr& node_hash, NodePay
 template <typename LeafValueType>
 std::optional<fr> ContentAddressedCache<LeafValueType>::get_node_by_index(uint32_t level, const index_t& index) const
 {
+    if (level >= nodes_by_index_.size()) {
+        return std::nullopt;
+    }
     auto it = nodes_by_index_[level].find(index);
     if (it == nodes_by_index_[level].end()) {
         return std::nullopt;
@@ -445,26 +476,41 @@ std::optional<fr> ContentAddressedCache<LeafValueType>::get_node_by_index(uint32
 template <typename LeafValueType>
 void ContentAddressedCache<LeafValueType>::put_node_by_index(uint32_t level, const index_t& index, const fr& node)
 {
+    auto& level_nodes = get_or_create_level(nodes_by_index_, level);
     // If there is no current journal then we just update the cache and leave
     if (journals_.empty()) {
-        nodes_by_index_[level][index] = node;
+        level_nodes[index] = node;
         return;
     }
 
     // There is a journal, grab it
     Journal& journal = journals_.back();
+    auto& journal_level_nodes = get_or_create_level(journal.nodes_by_index_, level);
 
     // If there is no node at the given location then add a nullopt to the journal
-    auto cacheIter = nodes_by_index_[level].find(index);
-    if (cacheIter == nodes_by_index_[level].end()) {
-        journal.nodes_by_index_[level][index] = std::nullopt;
+    auto cacheIter = level_nodes.find(index);
+    if (cacheIter == level_nodes.end()) {
+        journal_level_nodes[index] = std::nullopt;
     } else {
         // There is a node. If the journal does not have a node at this index then add it to the journal
-        auto journalIter = journal.nodes_by_index_[level].find(index);
-        if (journalIter == journal.nodes_by_index_[level].end()) {
-            journal.nodes_by_index_[level][index] = cacheIter->second;
+        auto journalIter = journal_level_nodes.find(index);
+        if (journalIter == journal_level_nodes.end()) {
+            journal_level_nodes[index] = cacheIter->second;
         }
     }
-    nodes_by_index_[level][index] = node;
+    level_nodes[index] = node;
+}
+
+template <typename LeafValueType> uint64_t ContentAddressedCache<LeafValueType>::memory_usage() const
+{
+    uint64_t bytes = flat_map_memory_usage(nodes_) + flat_map_memory_usage(leaves_) +
+                     flat_map_memory_usage(leaf_pre_image_by_index_) + levels_memory_usage(nodes_by_index_) +
+                     indices_.memory_usage();
+    bytes += journals_.capacity() * sizeof(Journal);
+    for (const Journal& journal : journals_) {
+        bytes += levels_memory_usage(journal.nodes_by_index_) + flat_map_memory_usage(journal.leaf_pre_image_by_index_) +
+                 (journal.new_leaf_keys_.capacity() * sizeof(uint256_t));
+    }
+    return bytes;
 }
 } // namespace bb::crypto::merkle_tree
@@ -75,6 +75,26 @@ TEST_F(ContentAddressedCacheTest, can_create_cache)
     EXPECT_NO_THROW(CacheType cache(depth));
 }
 
+TEST_F(ContentAddressedCacheTest, memory_usage_follows_writes)
+{
+    CacheType cache = create_cache(40);
+    // Nothing is held per level until that level is written to
+    uint64_t empty_usage = cache.memory_usage();
+    EXPECT_EQ(cache.get_node_by_index(40, 0), std::nullopt);
+    EXPECT_THROW(cache.put_node_by_index(41, 0, fr(1)), std::runtime_error);
+
+    add_to_cache(cache, 0, 1000, 10000);
+    uint64_t usage = cache.memory_usage();
+    EXPECT_GT(usage, empty_usage + (1000 * sizeof(fr)));
+
+    cache.checkpoint();
+    add_to_cache(cache, 1000, 1000, 10000);
+    EXPECT_GT(cache.memory_usage(), usage);
+
+    cache.reset(40);
+    EXPECT_EQ(cache.memory_usage(), empty_usage);
+}
+
 TEST_F(ContentAddressedCacheTest, can_checkpoint_cache)
 {
     CacheType cache = create_cache(10);
@@ -0,0 +1,190 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief Ordered map of unique leaf keys to leaf indices, used for the low leaf searches of indexed trees
+ * @details A two level B-tree: the entries are held in sorted blocks of at most MAX_BLOCK_SIZE entries, and the first
+ * key of every block is held in a separate sorted array. A lookup is a binary search over that array followed by a
+ * binary search within one block, both over contiguous memory, rather than a walk down a node based tree. Inserts
+ * and erases move at most one block's worth of entries, and only allocate when a block is split.
+ */
+class SortedKeyIndex {
+  public:
+    using Entry = std::pair<uint256_t, index_t>;
+
+    /**
+     * @brief Adds the key if it is not already present. Returns whether it was added.
+     */
+    bool insert(const uint256_t& key, const index_t& index)
+    {
+        if (blocks_.empty()) {
+            blocks_.emplace_back().reserve(MAX_BLOCK_SIZE + 1);
+            block_first_keys_.push_back(key);
+        }
+        // Keys below the first block go to the front of that block
+        const auto block_index = static_cast<size_t>(std::max(find_block(key), static_cast<ptrdiff_t>(0)));
+        std::vector<Entry>& block = blocks_[block_index];
+        auto it = lower_bound(block, key);
+        if (it != block.end() && it->first == key) {
+            return false;
+        }
+        block.insert(it, Entry(key, index));
+        block_first_keys_[block_index] = block.front().first;
+        ++size_;
+        if (block.size() > MAX_BLOCK_SIZE) {
+            split_block(block_index);
+        }
+        return true;
+    }
+
+    std::optional<index_t> find(const uint256_t& key) const
+    {
+        const ptrdiff_t block_index = find_block(key);
+        if (block_index < 0) {
+            return std::nullopt;
+        }
+        const std::vector<Entry>& block = blocks_[static_cast<size_t>(block_index)];
+        auto it = lower_bound(block, key);
+        if (it != block.end() && it->first == key) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Returns the entry with the largest key that is less than or equal to the given key, if there is one
+     */
+    std::optional<Entry> find_floor(const uint256_t& key) const
+    {
+        const ptrdiff_t block_index = find_block(key);
+        if (block_index < 0) {
+            return std::nullopt;
+        }
+        // The first key of the block is <= key, so the floor is in this block
+        const std::vector<Entry>& block = blocks_[static_cast<size_t>(block_index)];
+        auto it = std::upper_bound(
+            block.begin(), block.end(), key, [](const uint256_t& k, const Entry& entry) { return k < entry.first; });
+        return *(it - 1);
+    }
+
+    /**
+     * @brief Removes the given keys, ignoring any that are not present
+     */
+    void erase(const std::vector<uint256_t>& keys)
+    {
+        for (const uint256_t& key : keys) {
+            const ptrdiff_t block_index = find_block(key);
+            if (block_index < 0) {
+                continue;
+            }
+            const auto block_position = static_cast<size_t>(block_index);
+            std::vector<Entry>& block = blocks_[block_position];
+            auto it = lower_bound(block, key);
+            if (it == block.end() || it->first != key) {
+                continue;
+            }
+            block.erase(it);
+            --size_;
+            if (block.empty()) {
+                blocks_.erase(blocks_.begin() + block_index);
+                block_first_keys_.erase(block_first_keys_.begin() + block_index);
+            } else {
+                block_first_keys_[block_position] = block.front().first;
+            }
+        }
+    }
+
+    bool empty() const { return size_ == 0; }
+
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Calls func on every entry in ascending order of key
+     */
+    template <typename Func> void for_each(Func&& func) const
+    {
+        for (const std::vector<Entry>& block : blocks_) {
+            for (const Entry& entry : block) {
+                func(entry);
+            }
+        }
+    }
+
+    std::vector<Entry> to_vector() const
+    {
+        std::vector<Entry> entries;
+        entries.reserve(size_);
+        for_each([&](const Entry& entry) { entries.push_back(entry); });
+        return entries;
+    }
+
+    /**
+     * @brief Returns an estimate of the heap memory held by the index
+     */
+    uint64_t memory_usage() const
+    {
+        uint64_t bytes = (blocks_.capacity() * sizeof(std::vector<Entry>)) +
+                         (block_first_keys_.capacity() * sizeof(uint256_t));
+        for (const std::vector<Entry>& block : blocks_) {
+            bytes += block.capacity() * sizeof(Entry);
+        }
+        return bytes;
+    }
+
+    // Compares the contents, regardless of how they are split into blocks
+    bool operator==(const SortedKeyIndex& other) const
+    {
+        return size_ == other.size_ && to_vector() == other.to_vector();
+    }
+
+  private:
+    static constexpr size_t MAX_BLOCK_SIZE = 128;
+
+    std::vector<std::vector<Entry>> blocks_;
+    std::vector<uint256_t> block_first_keys_;
+    size_t size_ = 0;
+
+    // Returns the index of the last block whose first key is <= key, or -1 if there is none
+    ptrdiff_t find_block(const uint256_t& key) const
+    {
+        auto it = std::upper_bound(block_first_keys_.begin(), block_first_keys_.end(), key);
+        return (it - block_first_keys_.begin()) - 1;
+    }
+
+    template <typename Entries>
+    static auto lower_bound(Entries& entries, const uint256_t& key) -> decltype(entries.begin())
+    {
+        return std::lower_bound(
+            entries.begin(), entries.end(), key, [](const Entry& entry, const uint256_t& k) { return entry.first < k; });
+    }
+
+    void split_block(size_t block_index)
+    {
+        std::vector<Entry>& block = blocks_[block_index];
+        const auto middle = static_cast<ptrdiff_t>(block.size() / 2);
+        std::vector<Entry> upper;
+        upper.reserve(MAX_BLOCK_SIZE + 1);
+        upper.assign(block.begin() + middle, block.end());
+        block.resize(static_cast<size_t>(middle));
+        const uint256_t upper_first_key = upper.front().first;
+        blocks_.insert(blocks_.begin() + static_cast<ptrdiff_t>(block_index) + 1, std::move(upper));
+        block_first_keys_.insert(block_first_keys_.begin() + static_cast<ptrdiff_t>(block_index) + 1, upper_first_key);
+    }
+};
+
+} // namespace bb::crypto::merkle_tree
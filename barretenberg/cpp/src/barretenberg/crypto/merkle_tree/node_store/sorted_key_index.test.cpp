@@ -0,0 +1,83 @@
+#include "barretenberg/crypto/merkle_tree/node_store/sorted_key_index.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <map>
+#include <vector>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+// Small keys so that inserts collide and lookups land both on and between keys
+uint256_t random_key()
+{
+    return uint256_t(engine.get_random_uint64() % 20000);
+}
+
+void check_matches(const SortedKeyIndex& index, const std::map<uint256_t, index_t>& expected)
+{
+    EXPECT_EQ(index.size(), expected.size());
+    EXPECT_EQ(index.to_vector(), std::vector<SortedKeyIndex::Entry>(expected.begin(), expected.end()));
+    for (size_t i = 0; i < 1000; ++i) {
+        uint256_t key = random_key();
+        auto it = expected.find(key);
+        EXPECT_EQ(index.find(key), it == expected.end() ? std::nullopt : std::optional<index_t>(it->second));
+
+        auto floor_it = expected.upper_bound(key);
+        std::optional<SortedKeyIndex::Entry> expected_floor;
+        if (floor_it != expected.begin()) {
+            expected_floor = *std::prev(floor_it);
+        }
+        EXPECT_EQ(index.find_floor(key), expected_floor);
+    }
+}
+} // namespace
+
+TEST(SortedKeyIndex, MatchesOrderedMap)
+{
+    SortedKeyIndex index;
+    std::map<uint256_t, index_t> expected;
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.find_floor(uint256_t(5)), std::nullopt);
+
+    // Enough inserts to split the blocks many times over
+    for (index_t i = 0; i < 10000; ++i) {
+        uint256_t key = random_key();
+        EXPECT_EQ(index.insert(key, i), expected.insert({ key, i }).second);
+    }
+    check_matches(index, expected);
+}
+
+TEST(SortedKeyIndex, Erase)
+{
+    SortedKeyIndex index;
+    std::map<uint256_t, index_t> expected;
+    std::vector<uint256_t> old_keys;
+    std::vector<uint256_t> new_keys;
+    for (index_t i = 0; i < 5000; ++i) {
+        uint256_t key = random_key();
+        expected.insert({ key, i });
+        if (index.insert(key, i)) {
+            old_keys.push_back(key);
+        }
+    }
+    // Erasing recent keys, as a revert does, then older keys and keys that are not present
+    for (index_t i = 0; i < 30; ++i) {
+        uint256_t key = uint256_t(100000 + i);
+        index.insert(key, i);
+        new_keys.push_back(key);
+    }
+    index.erase(new_keys);
+    check_matches(index, expected);
+
+    std::vector<uint256_t> to_erase(old_keys.begin(), old_keys.begin() + 1000);
+    to_erase.push_back(uint256_t(200000));
+    for (const auto& key : to_erase) {
+        expected.erase(key);
+    }
+    index.erase(to_erase);
+    check_matches(index, expected);
+}
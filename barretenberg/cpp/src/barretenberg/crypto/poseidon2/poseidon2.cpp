@@ -5,6 +5,7 @@
 // =====================
 
 #include "poseidon2.hpp"
+#include "barretenberg/common/assert.hpp"
 
 namespace bb::crypto {
 /**
@@ -49,5 +50,41 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash_buffer(const std::vector<
     return hash(converted);
 }
 
+/**
+ * @brief Hashes consecutive pairs of field elements, i.e. output[i] = hash({ input[2i], input[2i + 1] })
+ * @details For a 2-element input the sponge absorbs both elements into the rate and squeezes once, so each hash is a
+ * single permutation of the state { lhs, rhs, 0, iv } and the result is the first element of the permuted state.
+ */
+template <typename Params>
+void Poseidon2<Params>::hash_pairs(std::span<const typename Poseidon2<Params>::FF> input,
+                                   std::span<typename Poseidon2<Params>::FF> output)
+{
+    using Permutation = Poseidon2Permutation<Params>;
+    using State = typename Permutation::State;
+    static_assert(Params::t == 4);
+    BB_ASSERT_EQ(input.size(), 2 * output.size(), "hash_pairs: input must hold two elements per output");
+
+    // IV of a 2-element input and a single output, see FieldSponge::hash_internal
+    const FF iv = FF(static_cast<uint256_t>(2) << 64);
+    const size_t num_pairs = output.size();
+    const size_t num_full_batches = num_pairs / HASH_PAIRS_LANES;
+
+    std::array<State, HASH_PAIRS_LANES> states;
+    for (size_t batch = 0; batch < num_full_batches; ++batch) {
+        const size_t start = batch * HASH_PAIRS_LANES;
+        // All inputs of the batch are read before any output is written, as `output` may alias `input`
+        for (size_t lane = 0; lane < HASH_PAIRS_LANES; ++lane) {
+            states[lane] = { input[2 * (start + lane)], input[(2 * (start + lane)) + 1], FF(0), iv };
+        }
+        Permutation::permutation_in_place(states);
+        for (size_t lane = 0; lane < HASH_PAIRS_LANES; ++lane) {
+            output[start + lane] = states[lane][0];
+        }
+    }
+    for (size_t i = num_full_batches * HASH_PAIRS_LANES; i < num_pairs; ++i) {
+        output[i] = Permutation::permutation({ input[2 * i], input[(2 * i) + 1], FF(0), iv })[0];
+    }
+}
+
 template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
 } // namespace bb::crypto
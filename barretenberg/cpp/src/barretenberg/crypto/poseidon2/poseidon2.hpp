@@ -10,6 +10,9 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <span>
+#include <vector>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -28,6 +31,16 @@ template <typename Params> class Poseidon2 {
      * @details Slice function cuts out the required number of bytes from the byte vector
      */
     static FF hash_buffer(const std::vector<uint8_t>& input);
+
+    // Number of permutations interleaved by hash_pairs
+    static constexpr size_t HASH_PAIRS_LANES = 4;
+    /**
+     * @brief Hashes consecutive pairs of field elements, i.e. output[i] = hash({ input[2i], input[2i + 1] })
+     * @details Used for Merkle tree levels. The permutations of HASH_PAIRS_LANES pairs are interleaved (see
+     * Poseidon2Permutation::permutation_in_place) and no memory is allocated. `output` may alias the start of
+     * `input`, so a level can be hashed in place.
+     */
+    static void hash_pairs(std::span<const FF> input, std::span<FF> output);
 };
 
 extern template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
@@ -64,3 +64,27 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, HashPairs)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+    // Sizes below, at and above a multiple of the number of interleaved lanes
+    for (const size_t num_pairs : { 0UL, 1UL, 3UL, 4UL, 9UL }) {
+        std::vector<fr> input(2 * num_pairs);
+        for (auto& x : input) {
+            x = fr::random_element(&engine);
+        }
+        std::vector<fr> expected(num_pairs);
+        for (size_t i = 0; i < num_pairs; ++i) {
+            expected[i] = Poseidon2::hash({ input[2 * i], input[(2 * i) + 1] });
+        }
+
+        std::vector<fr> output(num_pairs);
+        Poseidon2::hash_pairs(input, output);
+        EXPECT_EQ(output, expected);
+
+        // In place, as when hashing a Merkle tree level
+        Poseidon2::hash_pairs(input, std::span(input).subspan(0, num_pairs));
+        EXPECT_EQ(std::vector<fr>(input.begin(), input.begin() + static_cast<std::ptrdiff_t>(num_pairs)), expected);
+    }
+}
@@ -166,5 +166,57 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    /**
+     * @brief Applies the permutation to several independent states in place
+     * @details Every step of permutation() is a chain of dependent field operations; in the internal rounds a single
+     * S-box feeds the whole state. Applying each step to all states before moving on to the next one gives the CPU
+     * NUM_STATES independent chains to overlap, which pipelines the multiplications much better than permuting the
+     * states one after another.
+     *
+     * @tparam NUM_STATES
+     * @param states
+     */
+    template <size_t NUM_STATES> static constexpr void permutation_in_place(std::array<State, NUM_STATES>& states)
+    {
+        for (auto& state : states) {
+            matrix_multiplication_external(state);
+        }
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+                matrix_multiplication_external(state);
+            }
+        }
+
+        // The S-box of an internal round is a chain of three dependent multiplications, so each of its steps is applied
+        // to all states in turn
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        std::array<FF, NUM_STATES> squares;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (size_t j = 0; j < NUM_STATES; ++j) {
+                states[j][0] += round_constants[i][0];
+                squares[j] = states[j][0].sqr();
+            }
+            for (auto& square : squares) {
+                square.self_sqr();
+            }
+            for (size_t j = 0; j < NUM_STATES; ++j) {
+                states[j][0] *= squares[j];
+                matrix_multiplication_internal(states[j]);
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+                matrix_multiplication_external(state);
+            }
+        }
+    }
 };
 } // namespace bb::crypto
@@ -59,3 +59,21 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     };
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2Permutation, PermutationInPlace)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    std::array<Permutation::State, 3> states;
+    for (auto& state : states) {
+        for (auto& x : state) {
+            x = fr::random_element(&engine);
+        }
+    }
+    std::array<Permutation::State, 3> expected;
+    for (size_t i = 0; i < states.size(); ++i) {
+        expected[i] = Permutation::permutation(states[i]);
+    }
+
+    Permutation::permutation_in_place(states);
+    EXPECT_EQ(states, expected);
+}
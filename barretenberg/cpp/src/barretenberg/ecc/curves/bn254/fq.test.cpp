@@ -542,3 +542,31 @@ TEST(fq, EquivalentRandomness)
     constexpr auto pow_2_256 = fq(uint256_t(1) << 128).sqr();
     EXPECT_EQ(random_lo + pow_2_256 * random_hi, fq((random_uint512 % q).lo));
 }
+
+TEST(fq, BatchMul)
+{
+    // Sizes around the SIMD width, and inputs in coarse form (sums of reduced elements may lie in [p, 2p))
+    for (size_t n : { 0, 1, 7, 8, 9, 16, 37, 1000 }) {
+        std::vector<fq> a(n);
+        std::vector<fq> b(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = fq::random_element() + fq::random_element();
+            b[i] = fq::random_element() + fq::random_element();
+        }
+        if (n > 0) {
+            b[0] = fq::zero();
+        }
+        std::vector<fq> result(n);
+        fq::batch_mul(a, b, result);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], a[i] * b[i]);
+            // Same bounds as operator*
+            EXPECT_LT(uint256_t(result[i].data[0], result[i].data[1], result[i].data[2], result[i].data[3]),
+                      fq::modulus + fq::modulus);
+        }
+        // The output may alias an input
+        std::vector<fq> expected = result;
+        fq::batch_mul(a, b, a);
+        EXPECT_EQ(a, expected);
+    }
+}
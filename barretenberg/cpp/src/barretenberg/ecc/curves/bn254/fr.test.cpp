@@ -361,6 +361,55 @@ TEST(fr, BatchInvert)
     }
 }
 
+TEST(fr, BatchInvertLarge)
+{
+    // Large enough for the vectorized variant, with zeros and a partial last row
+    for (size_t n : { 1000, 1001 }) {
+        std::vector<fr> coeffs(n);
+        for (size_t i = 0; i < n; ++i) {
+            coeffs[i] = (i % 37 == 5) ? fr::zero() : fr::random_element();
+        }
+        std::vector<fr> inverses = coeffs;
+        fr::batch_invert(inverses);
+
+        for (size_t i = 0; i < n; ++i) {
+            if (coeffs[i].is_zero()) {
+                EXPECT_TRUE(inverses[i].is_zero());
+            } else {
+                EXPECT_EQ(inverses[i], coeffs[i].invert());
+            }
+        }
+    }
+}
+
+TEST(fr, BatchMul)
+{
+    // Sizes around the SIMD width, and inputs in coarse form (sums of reduced elements may lie in [p, 2p))
+    for (size_t n : { 0, 1, 7, 8, 9, 16, 37, 1000 }) {
+        std::vector<fr> a(n);
+        std::vector<fr> b(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = fr::random_element() + fr::random_element();
+            b[i] = fr::random_element() + fr::random_element();
+        }
+        if (n > 0) {
+            b[0] = fr::zero();
+        }
+        std::vector<fr> result(n);
+        fr::batch_mul(a, b, result);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], a[i] * b[i]);
+            // Same bounds as operator*
+            EXPECT_LT(uint256_t(result[i].data[0], result[i].data[1], result[i].data[2], result[i].data[3]),
+                      fr::modulus + fr::modulus);
+        }
+        // The output may alias an input
+        std::vector<fr> expected = result;
+        fr::batch_mul(a, b, a);
+        EXPECT_EQ(a, expected);
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
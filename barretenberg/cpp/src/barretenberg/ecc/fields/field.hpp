@@ -14,3 +14,5 @@
  */
 #include "./field_impl_generic.hpp"
 #include "./field_impl_x64.hpp"
+// Batched multiplication kernels, see field::batch_mul
+#include "./field_impl_batch.hpp"
@@ -342,6 +342,12 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+    /**
+     * @brief Compute r[i] = a[i] * b[i] for all i. `r` may alias `a` or `b`.
+     * @details Uses a SIMD kernel when the CPU supports one (see field_impl_batch.hpp), else operator*.
+     */
+    static void batch_mul(std::span<const field> a, std::span<const field> b, std::span<field> r) noexcept;
+    static bool has_vectorized_batch_mul() noexcept;
     /**
      * @brief Compute square root of the field element.
      *
@@ -705,6 +711,10 @@ template <class Params_> struct alignas(32) field {
 #endif
     static constexpr size_t COSET_GENERATOR_SIZE = 15;
     constexpr field tonelli_shanks_sqrt() const noexcept;
+    // batch_invert runs this many interleaved chains when batch_mul is vectorized and the input is large enough
+    static constexpr size_t BATCH_INVERT_LANES = 16;
+    static constexpr size_t BATCH_INVERT_MIN_VECTORIZED_SIZE = 256;
+    static void batch_invert_vectorized(std::span<field> coeffs) noexcept;
     static constexpr size_t primitive_root_log_size() noexcept;
     static constexpr std::array<field, COSET_GENERATOR_SIZE> compute_coset_generators() noexcept;
 
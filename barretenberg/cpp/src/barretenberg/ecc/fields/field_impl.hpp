@@ -10,6 +10,7 @@
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <algorithm>
 #include <memory>
 #include <span>
 #include <type_traits>
@@ -416,6 +417,11 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     PROFILE_THIS_NAME("fr::batch_invert");
     const size_t n = coeffs.size();
 
+    if (has_vectorized_batch_mul() && n >= BATCH_INVERT_MIN_VECTORIZED_SIZE) {
+        batch_invert_vectorized(coeffs);
+        return;
+    }
+
     auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
     auto skipped_ptr = std::static_pointer_cast<bool[]>(get_mem_slab(n));
     auto temporaries = temporaries_ptr.get();
@@ -460,6 +466,58 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     }
 }
 
+/**
+ * @brief Montgomery's batch inversion trick, with BATCH_INVERT_LANES independent accumulator chains
+ * @details The usual trick is a single chain of dependent multiplications, which cannot be vectorized. Instead, the
+ * element at index i is accumulated into chain i % BATCH_INVERT_LANES: a row of BATCH_INVERT_LANES consecutive elements
+ * then updates every chain at once with a single batch_mul. The chains are inverted together at the end, at the cost
+ * of a few extra multiplications. Zero elements are skipped, as in batch_invert.
+ */
+template <class T> void field<T>::batch_invert_vectorized(std::span<field> coeffs) noexcept
+{
+    constexpr size_t LANES = BATCH_INVERT_LANES;
+    const size_t n = coeffs.size();
+
+    auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
+    std::span<field> temporaries(temporaries_ptr.get(), n);
+
+    std::array<field, LANES> accumulators;
+    std::array<field, LANES> row;
+    std::array<field, LANES> products;
+    accumulators.fill(one());
+    // Gather the nonzero elements of a row, substituting 1 for the zero ones
+    auto load_row = [&](size_t start, size_t width) {
+        for (size_t lane = 0; lane < width; ++lane) {
+            row[lane] = coeffs[start + lane].is_zero() ? one() : coeffs[start + lane];
+        }
+    };
+
+    for (size_t start = 0; start < n; start += LANES) {
+        const size_t width = std::min(LANES, n - start);
+        std::copy_n(accumulators.begin(), width, &temporaries[start]);
+        load_row(start, width);
+        batch_mul({ accumulators.data(), width }, { row.data(), width }, { accumulators.data(), width });
+    }
+
+    // The accumulators are products of nonzero elements, so they are nonzero themselves
+    batch_invert(accumulators);
+
+    // Walk the rows back to front, peeling each row's element off its chain
+    const size_t num_rows = (n + LANES - 1) / LANES;
+    for (size_t rows_left = num_rows; rows_left > 0; --rows_left) {
+        const size_t start = (rows_left - 1) * LANES;
+        const size_t width = std::min(LANES, n - start);
+        load_row(start, width);
+        batch_mul({ accumulators.data(), width }, temporaries.subspan(start, width), { products.data(), width });
+        batch_mul({ accumulators.data(), width }, { row.data(), width }, { accumulators.data(), width });
+        for (size_t lane = 0; lane < width; ++lane) {
+            if (!coeffs[start + lane].is_zero()) {
+                coeffs[start + lane] = products[lane];
+            }
+        }
+    }
+}
+
 /**
  * @brief Implements an optimised variant of Tonelli-Shanks via lookup tables.
  * Algorithm taken from https://cr.yp.to/papers/sqroot-20011123-retypeset20220327.pdf
@@ -0,0 +1,270 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+/**
+ * @brief Batched field multiplication, see field::batch_mul
+ * @details The scalar x64 multiplication (field_impl_x64.hpp) computes one product at a time with MULX/ADX. On CPUs
+ * with AVX-512 IFMA (52-bit multiply-accumulate), 8 products can be computed at once by moving the operands into a
+ * struct-of-arrays layout of 5 × 52-bit limbs, one field element per 64-bit lane.
+ *
+ * The kernel is compiled with a function-level target attribute and selected at runtime, so binaries built for a
+ * baseline architecture (e.g. -march=skylake) still use it on capable machines and fall back to the scalar code
+ * elsewhere. It is only used for fields whose modulus is below 2^254, i.e. those for which the scalar code also uses
+ * coarse reduction: inputs and outputs are then in [0, 2p), exactly as for operator*.
+ */
+
+#include "./field_impl.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#if (BBERG_NO_ASM == 0) && defined(__x86_64__)
+#include <immintrin.h>
+#define BB_FIELD_HAS_AVX512_IFMA 1
+#else
+#define BB_FIELD_HAS_AVX512_IFMA 0
+#endif
+
+namespace bb::field_batch {
+
+/**
+ * @brief Whether batch_mul may use the AVX-512 IFMA kernel. Defaults to whether the CPU supports it; tests and
+ * benchmarks can switch it off to compare against the scalar code.
+ */
+inline bool& use_avx512_ifma()
+{
+#if BB_FIELD_HAS_AVX512_IFMA
+    static bool enabled = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    }();
+#else
+    static bool enabled = false;
+#endif
+    return enabled;
+}
+
+/**
+ * @brief Whether the AVX-512 IFMA kernel can be used for the field with parameters T
+ */
+template <class T> constexpr bool supports_avx512_ifma()
+{
+    return BB_FIELD_HAS_AVX512_IFMA && (T::modulus_3 < 0x4000000000000000ULL) &&
+           !(T::modulus_1 == 0 && T::modulus_2 == 0 && T::modulus_3 == 0);
+}
+
+#if BB_FIELD_HAS_AVX512_IFMA
+namespace avx512 {
+
+#define BB_AVX512_IFMA_TARGET __attribute__((target("avx512f,avx512ifma"), always_inline)) inline
+
+constexpr uint64_t LIMB_MASK = (1ULL << 52) - 1;
+
+/**
+ * @brief Load 8 consecutive field elements and transpose them so that limbs[j] holds the j-th 64-bit limb of each
+ */
+BB_AVX512_IFMA_TARGET void load_transposed(const uint64_t* src, __m512i (&limbs)[4])
+{
+    const __m512i pairs_0 = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i pairs_1 = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i halves_0 = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i halves_1 = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    const __m512i v0 = _mm512_loadu_si512(src);
+    const __m512i v1 = _mm512_loadu_si512(src + 8);
+    const __m512i v2 = _mm512_loadu_si512(src + 16);
+    const __m512i v3 = _mm512_loadu_si512(src + 24);
+    // limbs 0 and 1 (resp. 2 and 3) of elements 0-3 and 4-7
+    const __m512i lo_0123 = _mm512_permutex2var_epi64(v0, pairs_0, v1);
+    const __m512i hi_0123 = _mm512_permutex2var_epi64(v0, pairs_1, v1);
+    const __m512i lo_4567 = _mm512_permutex2var_epi64(v2, pairs_0, v3);
+    const __m512i hi_4567 = _mm512_permutex2var_epi64(v2, pairs_1, v3);
+    limbs[0] = _mm512_permutex2var_epi64(lo_0123, halves_0, lo_4567);
+    limbs[1] = _mm512_permutex2var_epi64(lo_0123, halves_1, lo_4567);
+    limbs[2] = _mm512_permutex2var_epi64(hi_0123, halves_0, hi_4567);
+    limbs[3] = _mm512_permutex2var_epi64(hi_0123, halves_1, hi_4567);
+}
+
+/**
+ * @brief Inverse of load_transposed
+ */
+BB_AVX512_IFMA_TARGET void store_transposed(uint64_t* dst, const __m512i (&limbs)[4])
+{
+    const __m512i pairs_0 = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i pairs_1 = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i halves_0 = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i halves_1 = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    const __m512i lo_0123 = _mm512_permutex2var_epi64(limbs[0], halves_0, limbs[1]);
+    const __m512i lo_4567 = _mm512_permutex2var_epi64(limbs[0], halves_1, limbs[1]);
+    const __m512i hi_0123 = _mm512_permutex2var_epi64(limbs[2], halves_0, limbs[3]);
+    const __m512i hi_4567 = _mm512_permutex2var_epi64(limbs[2], halves_1, limbs[3]);
+    _mm512_storeu_si512(dst, _mm512_permutex2var_epi64(lo_0123, pairs_0, hi_0123));
+    _mm512_storeu_si512(dst + 8, _mm512_permutex2var_epi64(lo_0123, pairs_1, hi_0123));
+    _mm512_storeu_si512(dst + 16, _mm512_permutex2var_epi64(lo_4567, pairs_0, hi_4567));
+    _mm512_storeu_si512(dst + 24, _mm512_permutex2var_epi64(lo_4567, pairs_1, hi_4567));
+}
+
+/**
+ * @brief Split 4 × 64-bit limbs into 5 × 52-bit limbs
+ */
+BB_AVX512_IFMA_TARGET void to_radix_52(const __m512i (&in)[4], __m512i (&out)[5])
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    out[0] = _mm512_and_si512(in[0], mask);
+    out[1] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(in[0], 52), _mm512_slli_epi64(in[1], 12)), mask);
+    out[2] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(in[1], 40), _mm512_slli_epi64(in[2], 24)), mask);
+    out[3] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(in[2], 28), _mm512_slli_epi64(in[3], 36)), mask);
+    out[4] = _mm512_srli_epi64(in[3], 16);
+}
+
+/**
+ * @brief Split 16 times the 4 × 64-bit input into 5 × 52-bit limbs (inputs are < 2^255, so the result fits 260 bits)
+ */
+BB_AVX512_IFMA_TARGET void to_radix_52_times_16(const __m512i (&in)[4], __m512i (&out)[5])
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    out[0] = _mm512_and_si512(_mm512_slli_epi64(in[0], 4), mask);
+    out[1] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(in[0], 48), _mm512_slli_epi64(in[1], 16)), mask);
+    out[2] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(in[1], 36), _mm512_slli_epi64(in[2], 28)), mask);
+    out[3] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(in[2], 24), _mm512_slli_epi64(in[3], 40)), mask);
+    out[4] = _mm512_srli_epi64(in[3], 12);
+}
+
+/**
+ * @brief Recombine normalized 5 × 52-bit limbs into 4 × 64-bit limbs
+ */
+BB_AVX512_IFMA_TARGET void from_radix_52(const __m512i (&in)[5], __m512i (&out)[4])
+{
+    out[0] = _mm512_or_si512(in[0], _mm512_slli_epi64(in[1], 52));
+    out[1] = _mm512_or_si512(_mm512_srli_epi64(in[1], 12), _mm512_slli_epi64(in[2], 40));
+    out[2] = _mm512_or_si512(_mm512_srli_epi64(in[2], 24), _mm512_slli_epi64(in[3], 28));
+    out[3] = _mm512_or_si512(_mm512_srli_epi64(in[3], 36), _mm512_slli_epi64(in[4], 16));
+}
+
+/**
+ * @brief Montgomery multiplication of GROUPS × 8 elements in radix 2^52
+ * @details With 5 limbs the Montgomery factor is 2^260 rather than the 2^256 of our representation. We account for
+ * this by multiplying b by 16 when converting it (see to_radix_52_times_16), which leaves
+ * (a ⋅ 16b + m ⋅ p) / 2^260 = a ⋅ b ⋅ 2^-256 mod p. For a, b < 2p and p < 2^254 the result is < 64p²/2^260 + p < 2p.
+ *
+ * Each reduction step depends on the previous one, so several independent groups are interleaved to hide the latency
+ * of the multiply-accumulate instructions.
+ */
+template <class T, size_t GROUPS>
+__attribute__((target("avx512f,avx512ifma"))) void mul(const uint64_t* a, const uint64_t* b, uint64_t* r)
+{
+    constexpr uint64_t modulus[4] = { T::modulus_0, T::modulus_1, T::modulus_2, T::modulus_3 };
+    const __m512i p[5] = {
+        _mm512_set1_epi64(static_cast<int64_t>(modulus[0] & LIMB_MASK)),
+        _mm512_set1_epi64(static_cast<int64_t>(((modulus[0] >> 52) | (modulus[1] << 12)) & LIMB_MASK)),
+        _mm512_set1_epi64(static_cast<int64_t>(((modulus[1] >> 40) | (modulus[2] << 24)) & LIMB_MASK)),
+        _mm512_set1_epi64(static_cast<int64_t>(((modulus[2] >> 28) | (modulus[3] << 36)) & LIMB_MASK)),
+        _mm512_set1_epi64(static_cast<int64_t>(modulus[3] >> 16)),
+    };
+    // r_inv = -p^{-1} mod 2^64, so its low 52 bits are -p^{-1} mod 2^52
+    const __m512i r_inv = _mm512_set1_epi64(static_cast<int64_t>(T::r_inv & LIMB_MASK));
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    const __m512i zero = _mm512_setzero_si512();
+
+    // 8 field elements of 4 limbs each
+    constexpr size_t GROUP_STRIDE = 32;
+    __m512i limbs[4];
+    __m512i x[GROUPS][5];
+    __m512i y[GROUPS][5];
+    for (size_t g = 0; g < GROUPS; ++g) {
+        load_transposed(a + g * GROUP_STRIDE, limbs);
+        to_radix_52(limbs, x[g]);
+        load_transposed(b + g * GROUP_STRIDE, limbs);
+        to_radix_52_times_16(limbs, y[g]);
+    }
+
+    // Operand scanning: the accumulator limbs hold sums of a few 52-bit values, so they cannot overflow 64 bits and
+    // carries only need to be propagated once at the end
+    __m512i t[GROUPS][6];
+    for (size_t g = 0; g < GROUPS; ++g) {
+        for (auto& limb : t[g]) {
+            limb = zero;
+        }
+    }
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t g = 0; g < GROUPS; ++g) {
+            for (size_t j = 0; j < 5; ++j) {
+                t[g][j] = _mm512_madd52lo_epu64(t[g][j], x[g][i], y[g][j]);
+                t[g][j + 1] = _mm512_madd52hi_epu64(t[g][j + 1], x[g][i], y[g][j]);
+            }
+        }
+        for (size_t g = 0; g < GROUPS; ++g) {
+            const __m512i m = _mm512_madd52lo_epu64(zero, t[g][0], r_inv);
+            for (size_t j = 0; j < 5; ++j) {
+                t[g][j] = _mm512_madd52lo_epu64(t[g][j], m, p[j]);
+                t[g][j + 1] = _mm512_madd52hi_epu64(t[g][j + 1], m, p[j]);
+            }
+            // The low 52 bits of t[0] are now zero; shift the accumulator down by one limb
+            t[g][0] = _mm512_add_epi64(t[g][1], _mm512_srli_epi64(t[g][0], 52));
+            t[g][1] = t[g][2];
+            t[g][2] = t[g][3];
+            t[g][3] = t[g][4];
+            t[g][4] = t[g][5];
+            t[g][5] = zero;
+        }
+    }
+    for (size_t g = 0; g < GROUPS; ++g) {
+        for (size_t j = 0; j < 4; ++j) {
+            t[g][j + 1] = _mm512_add_epi64(t[g][j + 1], _mm512_srli_epi64(t[g][j], 52));
+            t[g][j] = _mm512_and_si512(t[g][j], mask);
+        }
+        __m512i result[5] = { t[g][0], t[g][1], t[g][2], t[g][3], t[g][4] };
+        from_radix_52(result, limbs);
+        store_transposed(r + g * GROUP_STRIDE, limbs);
+    }
+}
+
+#undef BB_AVX512_IFMA_TARGET
+
+} // namespace avx512
+#endif
+
+} // namespace bb::field_batch
+
+namespace bb {
+
+template <class T> bool field<T>::has_vectorized_batch_mul() noexcept
+{
+    if constexpr (field_batch::supports_avx512_ifma<T>()) {
+        return field_batch::use_avx512_ifma();
+    } else {
+        return false;
+    }
+}
+
+template <class T>
+void field<T>::batch_mul(std::span<const field> a, std::span<const field> b, std::span<field> r) noexcept
+{
+    BB_ASSERT_EQ(a.size(), b.size());
+    BB_ASSERT_EQ(a.size(), r.size());
+    const size_t n = r.size();
+    size_t i = 0;
+#if BB_FIELD_HAS_AVX512_IFMA
+    if constexpr (field_batch::supports_avx512_ifma<T>()) {
+        if (field_batch::use_avx512_ifma()) {
+            constexpr size_t LANES = 8;
+            for (; i + 2 * LANES <= n; i += 2 * LANES) {
+                field_batch::avx512::mul<T, 2>(&a[i].data[0], &b[i].data[0], &r[i].data[0]);
+            }
+            if (i + LANES <= n) {
+                field_batch::avx512::mul<T, 1>(&a[i].data[0], &b[i].data[0], &r[i].data[0]);
+                i += LANES;
+            }
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        r[i] = a[i] * b[i];
+    }
+}
+
+} // namespace bb
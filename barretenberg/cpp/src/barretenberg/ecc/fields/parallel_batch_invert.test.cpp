@@ -0,0 +1,35 @@
+#include "barretenberg/ecc/fields/parallel_batch_invert.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+} // namespace
+
+/**
+ * @brief Several full blocks, a partial block and some zeros, which must be left unchanged
+ */
+TEST(ParallelBatchInvert, MatchesInvert)
+{
+    const size_t n = 3 * PARALLEL_BATCH_INVERT_BLOCK_SIZE + 17;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 7 == 0) ? fr::zero() : fr::random_element(&engine);
+    }
+    std::vector<fr> expected = coeffs;
+
+    parallel_batch_invert(std::span{ coeffs });
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(coeffs[i], expected[i].is_zero() ? fr::zero() : expected[i].invert());
+    }
+}
+
+TEST(ParallelBatchInvert, Empty)
+{
+    std::vector<fr> coeffs;
+    parallel_batch_invert(std::span{ coeffs });
+    EXPECT_TRUE(coeffs.empty());
+}
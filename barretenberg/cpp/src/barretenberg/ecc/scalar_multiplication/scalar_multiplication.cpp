@@ -18,6 +18,9 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace bb::scalar_multiplication {
 
 /**
@@ -221,21 +224,77 @@ uint32_t MSM<Curve>::get_scalar_slice(const typename Curve::ScalarField& scalar,
     return result;
 }
 
+/**
+ * @brief Given scalars that are *NOT* in Montgomery form, compute the bit length of the largest one
+ * @details Selector and small-range columns only have small nonzero values, e.g. booleans or 8-16 bit limbs. Pippenger
+ * rounds over bits above the returned width only see zero slices, so the callers skip them. The scan ORs the scalars
+ * together and stops as soon as the top bit of the field is set, so full-width scalars only pay for a short prefix.
+ *
+ * @tparam Curve
+ * @param scalars
+ * @param scalar_indices indices of the scalars to consider
+ * @return size_t 0 if all scalars are zero
+ */
+template <typename Curve>
+size_t MSM<Curve>::get_scalar_bit_width(std::span<const ScalarField> scalars,
+                                        std::span<const uint32_t> scalar_indices) noexcept
+{
+    constexpr size_t TOP_LIMB = (NUM_BITS_IN_FIELD - 1) / 64;
+    constexpr uint64_t TOP_BIT = 1ULL << ((NUM_BITS_IN_FIELD - 1) % 64);
+    std::array<uint64_t, 4> accumulated_limbs{ 0, 0, 0, 0 };
+    for (const uint32_t scalar_index : scalar_indices) {
+        const auto& scalar = scalars[scalar_index];
+        for (size_t j = 0; j < 4; ++j) {
+            accumulated_limbs[j] |= scalar.data[j];
+        }
+        if ((accumulated_limbs[TOP_LIMB] & TOP_BIT) != 0) {
+            break;
+        }
+    }
+    for (size_t j = 4; j-- > 0;) {
+        if (accumulated_limbs[j] != 0) {
+            return (64 * j) + numeric::get_msb(accumulated_limbs[j]) + 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Index of the first Pippenger round that can have a nonzero slice, for scalars of at most `num_bits` bits
+ * @details get_scalar_slice slices from the most significant bit down, so all rounds whose lowest bit is at least
+ * `num_bits` only see zero slices.
+ *
+ * @tparam Curve
+ * @param num_bits
+ * @param bits_per_slice
+ * @return size_t
+ */
+template <typename Curve>
+size_t MSM<Curve>::get_first_round(const size_t num_bits, const size_t bits_per_slice) noexcept
+{
+    return (NUM_BITS_IN_FIELD - std::min(num_bits, NUM_BITS_IN_FIELD)) / bits_per_slice;
+}
+
 /**
  * @brief For a given number of points, compute the optimal Pippenger bucket size
+ * @details Only the rounds that can be nonzero for scalars of at most `num_bits` bits are counted, see
+ * get_first_round.
  *
  * @tparam Curve
  * @param num_points
+ * @param num_bits
  * @return constexpr size_t
  */
-template <typename Curve> size_t MSM<Curve>::get_optimal_log_num_buckets(const size_t num_points) noexcept
+template <typename Curve>
+size_t MSM<Curve>::get_optimal_log_num_buckets(const size_t num_points, const size_t num_bits) noexcept
 {
     // We do 2 group operations per bucket, and they are full 3D Jacobian adds which are ~2x more than an affine add
     constexpr size_t COST_OF_BUCKET_OP_RELATIVE_TO_POINT = 5;
     size_t cached_cost = static_cast<size_t>(-1);
     size_t target_bit_slice = 0;
     for (size_t bit_slice = 1; bit_slice < 20; ++bit_slice) {
-        const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bit_slice);
+        const size_t num_rounds =
+            numeric::ceil_div(NUM_BITS_IN_FIELD, bit_slice) - get_first_round(num_bits, bit_slice);
         const size_t num_buckets = 1 << bit_slice;
         const size_t addition_cost = num_rounds * num_points;
         const size_t bucket_cost = num_rounds * num_buckets * COST_OF_BUCKET_OP_RELATIVE_TO_POINT;
@@ -329,6 +388,10 @@ void MSM<Curve>::add_affine_points(typename Curve::AffineElement* points,
                                    typename Curve::BaseField* scratch_space) noexcept
 {
     using Fq = typename Curve::BaseField;
+    if (Fq::has_vectorized_batch_mul() && num_points >= 8 * ADD_AFFINE_POINTS_LANES) {
+        add_affine_points_vectorized(points, num_points, scratch_space);
+        return;
+    }
     Fq batch_inversion_accumulator = Fq::one();
 
     for (size_t i = 0; i < num_points; i += 2) {
@@ -368,6 +431,122 @@ void MSM<Curve>::add_affine_points(typename Curve::AffineElement* points,
     }
 }
 
+/**
+ * @brief add_affine_points, with the field multiplications done by Fq::batch_mul
+ * @details The batch inversion in add_affine_points is a single chain of dependent multiplications. Here, the pair
+ * with index k is accumulated into chain k % ADD_AFFINE_POINTS_LANES instead, so that a row of consecutive pairs
+ * updates every chain at once. The remaining multiplications of a row (λ², λ⋅(x₁ - x₃)) are independent and batched
+ * as well. Since the outputs of a row may overwrite the inputs of the same row, each row is read completely before its
+ * outputs are written.
+ */
+template <typename Curve>
+void MSM<Curve>::add_affine_points_vectorized(typename Curve::AffineElement* points,
+                                              const size_t num_points,
+                                              typename Curve::BaseField* scratch_space) noexcept
+{
+    using Fq = typename Curve::BaseField;
+    constexpr size_t LANES = ADD_AFFINE_POINTS_LANES;
+    const size_t num_pairs = num_points / 2;
+
+    // lhs/rhs/products hold two batches of LANES multiplications side by side
+    std::array<Fq, LANES> accumulators;
+    std::array<Fq, 2 * LANES> lhs;
+    std::array<Fq, 2 * LANES> rhs;
+    std::array<Fq, 2 * LANES> products;
+    accumulators.fill(Fq::one());
+
+    for (size_t start = 0; start < num_pairs; start += LANES) {
+        const size_t width = std::min(LANES, num_pairs - start);
+        for (size_t lane = 0; lane < width; ++lane) {
+            const size_t i = 2 * (start + lane);
+            scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
+            points[i + 1].x -= points[i].x;                        // x2 - x1
+            lhs[lane] = points[i + 1].y - points[i].y;             // y2 - y1
+            rhs[lane] = accumulators[lane];
+            lhs[width + lane] = accumulators[lane];
+            rhs[width + lane] = points[i + 1].x;
+        }
+        // (y2 - y1) * accumulator_old and accumulator * (x2 - x1)
+        Fq::batch_mul({ lhs.data(), 2 * width }, { rhs.data(), 2 * width }, { products.data(), 2 * width });
+        for (size_t lane = 0; lane < width; ++lane) {
+            points[2 * (start + lane) + 1].y = products[lane];
+            accumulators[lane] = products[width + lane];
+        }
+    }
+    for (const Fq& accumulator : accumulators) {
+        if (accumulator == 0) {
+            // prefer abort to throw for code that might emit from multiple threads
+            abort_with_message("attempted to invert zero in add_affine_points");
+        }
+    }
+    Fq::batch_invert(accumulators);
+
+    // Iterate backwards through the rows of pairs; addition results are stored in the latter half of the array
+    std::array<Fq, LANES> x1;
+    std::array<Fq, LANES> y1;
+    std::array<Fq, LANES> lambda;
+    const size_t num_rows = (num_pairs + LANES - 1) / LANES;
+    for (size_t rows_left = num_rows; rows_left > 0; --rows_left) {
+        const size_t start = (rows_left - 1) * LANES;
+        const size_t width = std::min(LANES, num_pairs - start);
+        for (size_t lane = 0; lane < width; ++lane) {
+            const size_t i = 2 * (start + lane);
+            x1[lane] = points[i].x;
+            y1[lane] = points[i].y;
+            lhs[lane] = points[i + 1].y;
+            rhs[lane] = accumulators[lane];
+            lhs[width + lane] = accumulators[lane];
+            rhs[width + lane] = points[i + 1].x;
+        }
+        // lambda = (y2 - y1) / (x2 - x1), and update the accumulators
+        Fq::batch_mul({ lhs.data(), 2 * width }, { rhs.data(), 2 * width }, { products.data(), 2 * width });
+        std::copy_n(products.begin(), width, lambda.begin());
+        std::copy_n(products.begin() + static_cast<std::ptrdiff_t>(width), width, accumulators.begin());
+
+        // x3 = lambda_squared - x2 - x1, stored in lhs
+        Fq::batch_mul({ lambda.data(), width }, { lambda.data(), width }, { lhs.data(), width });
+        for (size_t lane = 0; lane < width; ++lane) {
+            lhs[lane] -= scratch_space[start + lane];
+            rhs[lane] = x1[lane] - lhs[lane];
+        }
+        // y3 = lambda * (x1 - x3) - y1
+        Fq::batch_mul({ rhs.data(), width }, { lambda.data(), width }, { products.data(), width });
+        for (size_t lane = 0; lane < width; ++lane) {
+            AffineElement& output = points[start + lane + num_pairs];
+            output.x = lhs[lane];
+            output.y = products[lane] - y1[lane];
+        }
+    }
+}
+
+/**
+ * @brief MSM for scalars that are all 1, i.e. boolean columns: the result is the plain sum of the points
+ * @details There is nothing to slice or sort, so the whole schedule targets a single bucket and is consumed with the
+ * affine trick directly, without a bucket reduction.
+ *
+ * @tparam Curve
+ * @param msm_data
+ * @return Curve::Element
+ */
+template <typename Curve>
+typename Curve::Element MSM<Curve>::sum_points_with_transformed_scalars(MSMData& msm_data) noexcept
+{
+    std::span<const uint32_t>& scalar_indices = msm_data.scalar_indices;
+    std::span<uint64_t>& point_schedule = msm_data.point_schedule;
+    const size_t size = scalar_indices.size();
+    // Bucket index 0 in the low 32 bits, point index in the high 32 bits (see evaluate_pippenger_round)
+    for (size_t i = 0; i < size; ++i) {
+        point_schedule[i] = static_cast<uint64_t>(scalar_indices[i]) << 32ULL;
+    }
+    AffineAdditionData affine_data = AffineAdditionData();
+    BucketAccumulators bucket_data = BucketAccumulators(1);
+    consume_point_schedule(point_schedule, msm_data.points, affine_data, bucket_data, 0, 0);
+    if (!bucket_data.bucket_exists.get(0)) {
+        return Curve::Group::point_at_infinity;
+    }
+    return Element(bucket_data.buckets[0]);
+}
+
 /**
  * @brief Top-level Pippenger algorithm where number of points is small and we are not using the Affine trick
  *
@@ -380,14 +559,15 @@ typename Curve::Element MSM<Curve>::small_pippenger_low_memory_with_transformed_
 {
     std::span<const uint32_t>& nonzero_scalar_indices = msm_data.scalar_indices;
     const size_t size = nonzero_scalar_indices.size();
-    const size_t bits_per_slice = get_optimal_log_num_buckets(size);
+    const size_t bits_per_slice = get_optimal_log_num_buckets(size, msm_data.num_bits);
     const size_t num_buckets = 1 << bits_per_slice;
     JacobianBucketAccumulators bucket_data = JacobianBucketAccumulators(num_buckets);
     Element round_output = Curve::Group::point_at_infinity;
 
     const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
 
-    for (size_t i = 0; i < num_rounds; ++i) {
+    // Skipped rounds are all zero; doubling their (infinite) output is a no-op
+    for (size_t i = get_first_round(msm_data.num_bits, bits_per_slice); i < num_rounds; ++i) {
         round_output = evaluate_small_pippenger_round(msm_data, i, bucket_data, round_output, bits_per_slice);
     }
     return round_output;
@@ -404,7 +584,10 @@ template <typename Curve>
 typename Curve::Element MSM<Curve>::pippenger_low_memory_with_transformed_scalars(MSMData& msm_data) noexcept
 {
     const size_t msm_size = msm_data.scalar_indices.size();
-    const size_t bits_per_slice = get_optimal_log_num_buckets(msm_size);
+    if (msm_data.num_bits == 1 && use_affine_trick(msm_size, 1)) {
+        return sum_points_with_transformed_scalars(msm_data);
+    }
+    const size_t bits_per_slice = get_optimal_log_num_buckets(msm_size, msm_data.num_bits);
     const size_t num_buckets = 1 << bits_per_slice;
 
     if (!use_affine_trick(msm_size, num_buckets)) {
@@ -418,7 +601,7 @@ typename Curve::Element MSM<Curve>::pippenger_low_memory_with_transformed_scalar
     Element round_output = Curve::Group::point_at_infinity;
 
     const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
-    for (size_t i = 0; i < num_rounds; ++i) {
+    for (size_t i = get_first_round(msm_data.num_bits, bits_per_slice); i < num_rounds; ++i) {
         round_output = evaluate_pippenger_round(msm_data, i, affine_data, bucket_data, round_output, bits_per_slice);
     }
 
@@ -784,7 +967,11 @@ std::vector<typename Curve::AffineElement> MSM<Curve>::batch_multi_scalar_mul(
                 std::span<const uint32_t> work_indices =
                     std::span<const uint32_t>{ &msm_scalar_indices[msm.batch_msm_index][msm.start_index], msm.size };
                 std::vector<uint64_t> point_schedule(msm.size);
-                MSMData msm_data(work_scalars, work_points, work_indices, std::span<uint64_t>(point_schedule));
+                MSMData msm_data(work_scalars,
+                                 work_points,
+                                 work_indices,
+                                 std::span<uint64_t>(point_schedule),
+                                 get_scalar_bit_width(work_scalars, work_indices));
                 Element msm_result = Curve::Group::point_at_infinity;
                 constexpr size_t SINGLE_MUL_THRESHOLD = 16;
                 if (msm.size < SINGLE_MUL_THRESHOLD) {
@@ -41,6 +41,8 @@ template <typename Curve> class MSM {
         std::span<const AffineElement> points;
         std::span<const uint32_t> scalar_indices;
         std::span<uint64_t> point_schedule;
+        // Upper bound on the bit length of the scalars (see get_scalar_bit_width). Rounds above it are skipped.
+        size_t num_bits = NUM_BITS_IN_FIELD;
     };
 
     /**
@@ -91,15 +93,25 @@ template <typename Curve> class MSM {
     static void add_affine_points(AffineElement* points,
                                   const size_t num_points,
                                   typename Curve::BaseField* scratch_space) noexcept;
+    // Number of interleaved batch inversion chains in add_affine_points_vectorized
+    static constexpr size_t ADD_AFFINE_POINTS_LANES = 16;
+    static void add_affine_points_vectorized(AffineElement* points,
+                                             const size_t num_points,
+                                             typename Curve::BaseField* scratch_space) noexcept;
     static void transform_scalar_and_get_nonzero_scalar_indices(std::span<typename Curve::ScalarField> scalars,
                                                                 std::vector<uint32_t>& consolidated_indices) noexcept;
 
     static std::vector<ThreadWorkUnits> get_work_units(std::vector<std::span<ScalarField>>& scalars,
                                                        std::vector<std::vector<uint32_t>>& msm_scalar_indices) noexcept;
     static uint32_t get_scalar_slice(const ScalarField& scalar, size_t round, size_t normal_slice_size) noexcept;
-    static size_t get_optimal_log_num_buckets(const size_t num_points) noexcept;
+    static size_t get_scalar_bit_width(std::span<const ScalarField> scalars,
+                                       std::span<const uint32_t> scalar_indices) noexcept;
+    static size_t get_first_round(const size_t num_bits, const size_t bits_per_slice) noexcept;
+    static size_t get_optimal_log_num_buckets(const size_t num_points,
+                                              const size_t num_bits = NUM_BITS_IN_FIELD) noexcept;
     static bool use_affine_trick(const size_t num_points, const size_t num_buckets) noexcept;
 
+    static Element sum_points_with_transformed_scalars(MSMData& msm_data) noexcept;
     static Element small_pippenger_low_memory_with_transformed_scalars(MSMData& msm_data) noexcept;
     static Element pippenger_low_memory_with_transformed_scalars(MSMData& msm_data) noexcept;
     static Element evaluate_small_pippenger_round(MSMData& msm_data,
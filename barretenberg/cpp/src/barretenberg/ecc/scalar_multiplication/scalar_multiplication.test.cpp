@@ -479,6 +479,54 @@ TYPED_TEST(ScalarMultiplicationTest, MSMEmptyPolynomial)
     EXPECT_EQ(result, Curve::Group::affine_point_at_infinity);
 }
 
+TYPED_TEST(ScalarMultiplicationTest, GetScalarBitWidth)
+{
+    SCALAR_MULTIPLICATION_TYPE_ALIASES
+    using MSM = scalar_multiplication::MSM<Curve>;
+
+    // The MSM only calls this on scalars converted out of Montgomery form
+    std::vector<ScalarField> scalars;
+    for (const uint256_t value : { uint256_t(0), uint256_t(1), uint256_t(0x80), uint256_t(0x3f) }) {
+        scalars.push_back(ScalarField(value).from_montgomery_form());
+    }
+    std::vector<uint32_t> indices{ 0, 1, 2, 3 };
+    EXPECT_EQ(MSM::get_scalar_bit_width(scalars, indices), 8);
+    EXPECT_EQ(MSM::get_scalar_bit_width(scalars, std::span<const uint32_t>(indices).subspan(0, 2)), 1);
+    EXPECT_EQ(MSM::get_scalar_bit_width(scalars, std::span<const uint32_t>(indices).subspan(0, 1)), 0);
+
+    scalars.push_back(ScalarField(uint256_t(1) << 100).from_montgomery_form());
+    indices.push_back(4);
+    EXPECT_EQ(MSM::get_scalar_bit_width(scalars, indices), 101);
+}
+
+/**
+ * @brief MSMs over boolean and small-range scalars, which skip the rounds above their bit width
+ */
+TYPED_TEST(ScalarMultiplicationTest, MSMSmallScalars)
+{
+    SCALAR_MULTIPLICATION_TYPE_ALIASES
+    using AffineElement = typename Curve::AffineElement;
+
+    // Small inputs go through the Jacobian bucket path, large ones through the affine trick
+    for (const size_t num_points : { 100UL, 5000UL }) {
+        for (const size_t num_bits : { 1UL, 8UL, 16UL, 70UL }) {
+            std::vector<ScalarField> scalars(num_points);
+            for (size_t i = 0; i < num_points; ++i) {
+                // Leave some zeros in, as in sparse selector columns
+                const uint256_t value = engine.get_random_uint256() & ((uint256_t(1) << num_bits) - 1);
+                scalars[i] = (i % 3 == 0) ? ScalarField(0) : ScalarField(value);
+            }
+            std::span<const AffineElement> points(&TestFixture::generators[0], num_points);
+            const AffineElement expected = TestFixture::naive_msm(scalars, points);
+
+            PolynomialSpan<ScalarField> scalar_span(0, scalars);
+            EXPECT_EQ(scalar_multiplication::MSM<Curve>::msm(points, scalar_span), expected);
+            EXPECT_EQ(scalar_multiplication::MSM<Curve>::msm(points, scalar_span, /*handle_edge_cases=*/true),
+                      expected);
+        }
+    }
+}
+
 TEST(ScalarMultiplication, SmallInputsExplicit)
 {
     uint256_t x0(0x68df84429941826a, 0xeb08934ed806781c, 0xc14b6a2e4f796a73, 0x08dc1a9a11a3c8db);
@@ -9,6 +9,7 @@
 #include "barretenberg/common/debug_log.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/ecc/fields/parallel_batch_invert.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 
 #include "barretenberg/relations/relation_parameters.hpp"
@@ -168,11 +169,11 @@ void compute_grand_product(typename Flavor::ProverPolynomials& full_polynomials,
                 denominator.at(i) = denominator[i] * denominator_scaling;
             }
         }
-
-        // Final step: invert denominator
-        FF::batch_invert(std::span{ &denominator.data()[start], end - start });
     });
 
+    // Final step: invert denominator, in cache-sized blocks rather than one large batch per thread
+    parallel_batch_invert(std::span{ denominator.data(), active_domain_size - 1 });
+
     DEBUG_LOG_ALL(numerator.coeffs());
     DEBUG_LOG_ALL(denominator.coeffs());
 
@@ -4,6 +4,7 @@
 #include "lmdb.h"
 #include <cstdint>
 #include <functional>
+#include <type_traits>
 #include <vector>
 
 namespace bb::lmdblib {
@@ -56,6 +57,13 @@ class LMDBTransaction {
 
     template <typename T> bool get_value(T& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    /*
+     * Points data at the value stored against the key, without copying it.
+     * The value is owned by LMDB and is only valid until the transaction ends, or in a write transaction until the next
+     * write.
+     */
+    template <typename T> bool get_value(T& key, MDB_val& data, const LMDBDatabase& db) const;
+
     template <typename T>
     void get_all_values_greater_or_equal_key(const T& key,
                                              std::vector<std::vector<uint8_t>>& data,
@@ -70,6 +78,8 @@ class LMDBTransaction {
 
     bool get_value(std::vector<uint8_t>& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    bool get_value(MDB_val& key, MDB_val& data, const LMDBDatabase& db) const;
+
   protected:
     std::shared_ptr<LMDBEnvironment> _environment;
     uint64_t _id;
@@ -89,6 +99,19 @@ template <typename T> bool LMDBTransaction::get_value(T& key, uint64_t& data, co
     return get_value(keyBuffer, data, db);
 }
 
+template <typename T> bool LMDBTransaction::get_value(T& key, MDB_val& data, const LMDBDatabase& db) const
+{
+    if constexpr (std::is_same_v<T, uint256_t>) {
+        // 256 bit keys are stored as their limbs, so the key can be used in place without serialising it
+        MDB_val dbKey{ .mv_size = sizeof(key.data), .mv_data = static_cast<void*>(key.data) };
+        return get_value(dbKey, data, db);
+    } else {
+        std::vector<uint8_t> keyBuffer = serialise_key(key);
+        MDB_val dbKey{ .mv_size = keyBuffer.size(), .mv_data = static_cast<void*>(keyBuffer.data()) };
+        return get_value(dbKey, data, db);
+    }
+}
+
 template <typename T, typename K>
 bool LMDBTransaction::get_value_or_previous(T& key, K& data, const LMDBDatabase& db) const
 {
@@ -114,6 +114,11 @@ bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db, const bb::lmdbl
     return true;
 }
 
+bool get_value(MDB_val& key, MDB_val& data, const LMDBDatabase& db, const bb::lmdblib::LMDBTransaction& tx)
+{
+    return call_lmdb_func(mdb_get, tx.underlying(), db.underlying(), &key, &data);
+}
+
 bool set_at_key(const LMDBCursor& cursor, Key& key)
 {
     MDB_val dbKey;
@@ -225,6 +225,10 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
         WorldStateMessageType::SYNC_BLOCK,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return sync_block(obj, buffer); });
 
+    _dispatcher.register_target(
+        WorldStateMessageType::SYNC_BLOCKS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return sync_blocks(obj, buffer); });
+
     _dispatcher.register_target(
         WorldStateMessageType::CREATE_FORK,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return create_fork(obj, buffer); });
@@ -248,6 +252,10 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
         WorldStateMessageType::GET_STATUS,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_status(obj, buffer); });
 
+    _dispatcher.register_target(
+        WorldStateMessageType::GET_FORK_STATS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_fork_stats(obj, buffer); });
+
     _dispatcher.register_target(WorldStateMessageType::CLOSE,
                                 [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return close(obj, buffer); });
 
@@ -737,6 +745,32 @@ bool WorldStateWrapper::sync_block(msgpack::object& obj, msgpack::sbuffer& buf)
     return true;
 }
 
+bool WorldStateWrapper::sync_blocks(msgpack::object& obj, msgpack::sbuffer& buf)
+{
+    TypedMessage<SyncBlocksRequest> request;
+    obj.convert(request);
+
+    std::vector<SyncBlockData> blocks;
+    blocks.reserve(request.value.blocks.size());
+    for (auto& block : request.value.blocks) {
+        blocks.push_back(SyncBlockData{
+            .blockStateRef = std::move(block.blockStateRef),
+            .blockHeaderHash = block.blockHeaderHash,
+            .notes = std::move(block.paddedNoteHashes),
+            .l1ToL2Messages = std::move(block.paddedL1ToL2Messages),
+            .nullifiers = std::move(block.paddedNullifiers),
+            .publicWrites = std::move(block.publicDataWrites),
+        });
+    }
+    WorldStateStatusFull status = _ws->sync_blocks(blocks);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<WorldStateStatusFull> resp_msg(WorldStateMessageType::SYNC_BLOCKS, header, { status });
+    msgpack::pack(buf, resp_msg);
+
+    return true;
+}
+
 bool WorldStateWrapper::create_fork(msgpack::object& obj, msgpack::sbuffer& buf)
 {
     TypedMessage<CreateForkRequest> request;
@@ -910,6 +944,20 @@ bool WorldStateWrapper::get_status(msgpack::object& obj, msgpack::sbuffer& buf)
     return true;
 }
 
+bool WorldStateWrapper::get_fork_stats(msgpack::object& obj, msgpack::sbuffer& buf) const
+{
+    HeaderOnlyMessage request;
+    obj.convert(request);
+
+    WorldStateForkStats stats = _ws->get_fork_stats();
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<WorldStateForkStats> resp_msg(WorldStateMessageType::GET_FORK_STATS, header, { stats });
+    msgpack::pack(buf, resp_msg);
+
+    return true;
+}
+
 bool WorldStateWrapper::copy_stores(msgpack::object& obj, msgpack::sbuffer& buffer)
 {
     TypedMessage<CopyStoresRequest> request;
@@ -54,6 +54,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool rollback(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool sync_block(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool sync_blocks(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool create_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
     bool delete_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
@@ -65,6 +66,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool remove_historical(msgpack::object& obj, msgpack::sbuffer& buffer) const;
 
     bool get_status(msgpack::object& obj, msgpack::sbuffer& buffer) const;
+    bool get_fork_stats(msgpack::object& obj, msgpack::sbuffer& buffer) const;
 
     bool checkpoint(msgpack::object& obj, msgpack::sbuffer& buffer);
     bool commit_checkpoint(msgpack::object& obj, msgpack::sbuffer& buffer);
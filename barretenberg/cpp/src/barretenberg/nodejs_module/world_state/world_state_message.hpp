@@ -59,6 +59,10 @@ enum WorldStateMessageType {
 
     COPY_STORES,
 
+    SYNC_BLOCKS,
+
+    GET_FORK_STATS,
+
     CLOSE = 999,
 };
 
@@ -250,6 +254,11 @@ struct SyncBlockRequest {
                    publicDataWrites);
 };
 
+struct SyncBlocksRequest {
+    std::vector<SyncBlockRequest> blocks;
+    MSGPACK_FIELDS(blocks);
+};
+
 struct CopyStoresRequest {
     std::string dstPath;
     std::optional<bool> compact;
@@ -98,3 +98,23 @@ TYPED_TEST(BarycentricDataTests, BarycentricData5to6)
     Univariate<FF, num_evals> expected{ { 1, 3, 25, 109, 321, 751 } };
     EXPECT_EQ(ext1, expected);
 }
+
+TYPED_TEST(BarycentricDataTests, BarycentricData6to16)
+{
+    BARYCENTIC_DATA_TESTS_TYPE_ALIASES
+
+    // Enough new evaluations for the batched multiplication path of extend_to
+    const size_t domain_size = 6;
+    const size_t num_evals = 16;
+    auto f = [](size_t x) { return FF(x).pow(5) + FF(2) * FF(x) * FF(x) + FF(3); };
+    Univariate<FF, domain_size> e1;
+    Univariate<FF, num_evals> expected;
+    for (size_t x = 0; x < num_evals; ++x) {
+        if (x < domain_size) {
+            e1.value_at(x) = f(x);
+        }
+        expected.value_at(x) = f(x);
+    }
+    Univariate<FF, num_evals> ext1 = e1.template extend_to<num_evals>();
+    EXPECT_EQ(ext1, expected);
+}
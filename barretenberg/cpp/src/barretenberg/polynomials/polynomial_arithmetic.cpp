@@ -11,6 +11,8 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "iterate_over_domain.hpp"
+#include <algorithm>
+#include <array>
 #include <math.h>
 #include <memory.h>
 #include <memory>
@@ -174,6 +176,11 @@ void compute_multiplicative_subgroup(const size_t log2_subgroup_size,
     }
 }
 
+// Maximum number of twiddle factor multiplications batched together in fft_inner_parallel, and the smallest FFT round
+// (number of butterflies per block) for which batching is used
+constexpr size_t FFT_BATCH_SIZE = 64;
+constexpr size_t FFT_BATCH_MIN_BLOCK_SIZE = 16;
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_inner_parallel(std::vector<Fr*> coeffs,
@@ -224,6 +231,7 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
 
     // outer FFT loop
     for (size_t m = 2; m < (domain.size); m <<= 1) {
+        const bool use_batch_mul = Fr::has_vectorized_batch_mul() && m >= FFT_BATCH_MIN_BLOCK_SIZE;
         parallel_for(domain.num_threads, [&](size_t j) {
             Fr temp;
 
@@ -275,7 +283,34 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
             // Finally, we want to treat the final round differently from the others,
             // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
             // `scratch_space`
-            if (m != (domain.size >> 1)) {
+            // When a vectorized batch_mul is available, the twiddle factor multiplications of up to
+            // FFT_BATCH_SIZE consecutive butterflies are done in one batch: within a block of m butterflies, both the
+            // roots and the odd-indexed inputs are contiguous.
+            if (use_batch_mul) {
+                std::array<Fr, FFT_BATCH_SIZE> products;
+                for (size_t i = start; i < end;) {
+                    const size_t k1 = (i & index_mask) << 1;
+                    const size_t j1 = i & block_mask;
+                    const size_t batch_size = std::min({ FFT_BATCH_SIZE, m - j1, end - i });
+                    Fr::batch_mul({ &round_roots[j1], batch_size },
+                                  { &scratch_space[k1 + j1 + m], batch_size },
+                                  { products.data(), batch_size });
+                    for (size_t l = 0; l < batch_size; ++l) {
+                        const size_t even_idx = k1 + j1 + l;
+                        const size_t odd_idx = even_idx + m;
+                        if (m != (domain.size >> 1)) {
+                            scratch_space[odd_idx] = scratch_space[even_idx] - products[l];
+                            scratch_space[even_idx] += products[l];
+                        } else {
+                            coeffs[odd_idx >> log2_poly_size][odd_idx & poly_mask] =
+                                scratch_space[even_idx] - products[l];
+                            coeffs[even_idx >> log2_poly_size][even_idx & poly_mask] =
+                                scratch_space[even_idx] + products[l];
+                        }
+                    }
+                    i += batch_size;
+                }
+            } else if (m != (domain.size >> 1)) {
                 for (size_t i = start; i < end; ++i) {
                     size_t k1 = (i & index_mask) << 1;
                     size_t j1 = i & block_mask;
@@ -335,6 +370,7 @@ void fft_inner_parallel(
 
     // outer FFT loop
     for (size_t m = 2; m < (domain.size); m <<= 1) {
+        const bool use_batch_mul = Fr::has_vectorized_batch_mul() && m >= FFT_BATCH_MIN_BLOCK_SIZE;
         parallel_for(domain.num_threads, [&](size_t j) {
             Fr temp;
 
@@ -386,12 +422,30 @@ void fft_inner_parallel(
             // Finally, we want to treat the final round differently from the others,
             // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
             // `scratch_space`
-            for (size_t i = start; i < end; ++i) {
-                size_t k1 = (i & index_mask) << 1;
-                size_t j1 = i & block_mask;
-                temp = round_roots[j1] * target[k1 + j1 + m];
-                target[k1 + j1 + m] = target[k1 + j1] - temp;
-                target[k1 + j1] += temp;
+            if (use_batch_mul) {
+                std::array<Fr, FFT_BATCH_SIZE> products;
+                for (size_t i = start; i < end;) {
+                    const size_t k1 = (i & index_mask) << 1;
+                    const size_t j1 = i & block_mask;
+                    const size_t batch_size = std::min({ FFT_BATCH_SIZE, m - j1, end - i });
+                    Fr::batch_mul({ &round_roots[j1], batch_size },
+                                  { &target[k1 + j1 + m], batch_size },
+                                  { products.data(), batch_size });
+                    for (size_t l = 0; l < batch_size; ++l) {
+                        const size_t even_idx = k1 + j1 + l;
+                        target[even_idx + m] = target[even_idx] - products[l];
+                        target[even_idx] += products[l];
+                    }
+                    i += batch_size;
+                }
+            } else {
+                for (size_t i = start; i < end; ++i) {
+                    size_t k1 = (i & index_mask) << 1;
+                    size_t j1 = i & block_mask;
+                    temp = round_roots[j1] * target[k1 + j1 + m];
+                    target[k1 + j1 + m] = target[k1 + j1] - temp;
+                    target[k1 + j1] += temp;
+                }
             }
         });
     }
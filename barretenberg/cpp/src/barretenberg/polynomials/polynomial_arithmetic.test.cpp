@@ -56,6 +56,29 @@ TEST(polynomials, fft_with_small_degree)
     }
 }
 
+TEST(polynomials, fft_into_target_matches_in_place_fft)
+{
+    // Large enough for the late rounds to take the batched butterfly path
+    constexpr size_t n = 1 << 10;
+    std::vector<fr> poly(n);
+    for (auto& coeff : poly) {
+        coeff = fr::random_element();
+    }
+
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    std::vector<fr> in_place = poly;
+    std::vector<fr> target(n);
+    polynomial_arithmetic::fft(in_place.data(), domain);
+    polynomial_arithmetic::fft(poly.data(), target.data(), domain);
+    EXPECT_EQ(target, in_place);
+
+    polynomial_arithmetic::ifft(in_place.data(), domain);
+    polynomial_arithmetic::ifft(target.data(), poly.data(), domain);
+    EXPECT_EQ(poly, in_place);
+}
+
 TEST(polynomials, split_polynomial_fft)
 {
     constexpr size_t n = 256;
@@ -531,6 +531,12 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
                 linear_term += three_a_plus_two_b;
             }
         } else {
+            if constexpr (requires { Fr::has_vectorized_batch_mul(); }) {
+                if (Fr::has_vectorized_batch_mul()) {
+                    extend_with_batch_mul<Data>(result);
+                    return result;
+                }
+            }
             for (size_t k = domain_end; k != EXTENDED_DOMAIN_END; ++k) {
                 result.value_at(k) = 0;
                 // compute each term v_j / (d_j*(x-x_j)) of the sum
@@ -546,6 +552,35 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
         return result;
     }
 
+    /**
+     * @brief The barycentric branch of extend_to, with all of its multiplications done by two calls to Fr::batch_mul
+     * @details The denominator inverses of the new evaluations form a single contiguous range of Data, so the terms
+     * v_j / (d_j*(x_k-x_j)) of every new evaluation are computed at once, as are the final scalings by B(x_k).
+     */
+    template <typename Data, size_t EXTENDED_DOMAIN_END, size_t NUM_SKIPPED_INDICES>
+    void extend_with_batch_mul(Univariate<Fr, EXTENDED_DOMAIN_END, 0, NUM_SKIPPED_INDICES>& result) const
+    {
+        static constexpr size_t NUM_NEW_EVALUATIONS = EXTENDED_DOMAIN_END - domain_end;
+        std::array<Fr, NUM_NEW_EVALUATIONS * LENGTH> terms;
+        for (size_t k = 0; k < NUM_NEW_EVALUATIONS; ++k) {
+            std::copy(evaluations.begin(), evaluations.end(), terms.begin() + static_cast<std::ptrdiff_t>(k * LENGTH));
+        }
+        Fr::batch_mul(terms,
+                      { &Data::precomputed_denominator_inverses[LENGTH * domain_end + domain_start], terms.size() },
+                      terms);
+
+        std::array<Fr, NUM_NEW_EVALUATIONS> sums;
+        for (size_t k = 0; k < NUM_NEW_EVALUATIONS; ++k) {
+            sums[k] = 0;
+            for (size_t j = 0; j < LENGTH; ++j) {
+                sums[k] += terms[k * LENGTH + j];
+            }
+        }
+        Fr::batch_mul(sums,
+                      { &Data::full_numerator_values[domain_end], NUM_NEW_EVALUATIONS },
+                      { &result.value_at(domain_end), NUM_NEW_EVALUATIONS });
+    }
+
     template <size_t INITIAL_LENGTH> void self_extend_from()
     {
         if constexpr (INITIAL_LENGTH == 2) {
@@ -126,6 +126,15 @@ void ProtogalaxyProver_<Flavor, NUM_KEYS>::update_target_sum_and_fold(
     std::shared_ptr<DeciderPK> incoming = keys[1];
     accumulator->is_accumulator = true;
 
+    // The folded polynomials can only be non-trivial on rows where one of the folded keys is
+    if (accumulator->relation_active_ranges.empty() || incoming->relation_active_ranges.empty()) {
+        accumulator->relation_active_ranges.clear();
+    } else {
+        auto ranges = accumulator->relation_active_ranges;
+        ranges.insert(ranges.end(), incoming->relation_active_ranges.begin(), incoming->relation_active_ranges.end());
+        accumulator->relation_active_ranges = ExecutionTraceUsageTracker::construct_union_of_ranges(ranges);
+    }
+
     // At this point the virtual sizes of the polynomials should already agree
     BB_ASSERT_EQ(accumulator->proving_key.polynomials.w_l.virtual_size(),
                  incoming->proving_key.polynomials.w_l.virtual_size());
@@ -10,6 +10,7 @@
 
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/parallel_batch_invert.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 
@@ -292,7 +293,7 @@ template <typename FF_> class DatabusLookupRelationImpl {
 
         // Compute inverse polynomial I in place by inverting the product at each row
         // Note: zeroes are ignored as they are not used anyway
-        FF::batch_invert(inverse_polynomial.coeffs());
+        parallel_batch_invert(inverse_polynomial.coeffs());
     };
 
     /**
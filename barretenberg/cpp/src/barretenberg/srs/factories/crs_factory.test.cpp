@@ -4,6 +4,7 @@
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
+#include "barretenberg/srs/factories/mmap_crs.hpp"
 #include "barretenberg/srs/factories/native_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 #include <fstream>
@@ -100,3 +101,32 @@ TEST(CrsFactory, grumpkin)
     ASSERT_ANY_THROW(check_grumpkin_consistency(temp_crs_path, 1, /*allow_download=*/false));
     check_grumpkin_consistency(temp_crs_path, 1, /*allow_download=*/true);
 }
+
+TEST(CrsFactory, NativeCache)
+{
+    const size_t num_points = 16;
+    const std::filesystem::path& temp_crs_path = "barretenberg_srs_test_crs_native";
+    fs::remove_all(temp_crs_path);
+    fs::create_directories(temp_crs_path);
+
+    std::vector<g1::affine_element> points(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = g1::affine_element(g1::one * fr::random_element());
+    }
+    auto cache_path = bn254_native_cache_path(temp_crs_path);
+    ASSERT_TRUE(write_native_crs_cache<g1::affine_element>(cache_path, points));
+
+    // A cache that is large enough maps all of its points, whatever the requested size.
+    auto crs = open_mmap_bn254_crs(cache_path, num_points / 2, g2::affine_one);
+    ASSERT_NE(crs, nullptr);
+    EXPECT_EQ(crs->get_monomial_size(), num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(std::make_pair(i, crs->get_monomial_points()[i]), std::make_pair(i, points[i]));
+    }
+    EXPECT_EQ(crs->get_g1_identity(), points[0]);
+
+    // Too-small caches and caches of another curve are rejected rather than misread.
+    EXPECT_EQ(open_mmap_bn254_crs(cache_path, num_points + 1, g2::affine_one), nullptr);
+    EXPECT_EQ(open_mmap_grumpkin_crs(cache_path, 1), nullptr);
+    fs::remove_all(temp_crs_path);
+}
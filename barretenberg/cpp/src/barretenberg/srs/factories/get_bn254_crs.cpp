@@ -1,6 +1,7 @@
 #include "get_bn254_crs.hpp"
 #include "barretenberg/api/exec_pipe.hpp"
 #include "barretenberg/api/file_io.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 
 namespace {
@@ -29,6 +30,17 @@ std::vector<uint8_t> download_bn254_g2_data()
     std::string command = "curl '" + url + "'";
     return bb::exec_pipe(command);
 }
+
+std::vector<bb::g1::affine_element> deserialize_bn254_g1_data(const std::vector<uint8_t>& data, size_t num_points)
+{
+    std::vector<bb::g1::affine_element> points(num_points);
+    bb::parallel_for_range(num_points, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            points[i] = from_buffer<bb::g1::affine_element>(data, i * sizeof(bb::g1::affine_element));
+        }
+    });
+    return points;
+}
 } // namespace
 
 namespace bb {
@@ -46,11 +58,7 @@ std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& p
     if (g1_downloaded_points >= num_points) {
         vinfo("using cached bn254 crs with num points ", std::to_string(g1_downloaded_points), " at ", g1_path);
         auto data = read_file(g1_path, num_points * sizeof(g1::affine_element));
-        auto points = std::vector<g1::affine_element>(num_points);
-        for (size_t i = 0; i < num_points; ++i) {
-            points[i] = from_buffer<g1::affine_element>(data, i * sizeof(g1::affine_element));
-        }
-        return points;
+        return deserialize_bn254_g1_data(data, num_points);
     }
 
     if (!allow_download && g1_downloaded_points == 0) {
@@ -66,11 +74,7 @@ std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& p
     auto data = download_bn254_g1_data(num_points);
     write_file(g1_path, data);
 
-    auto points = std::vector<g1::affine_element>(num_points);
-    for (size_t i = 0; i < num_points; ++i) {
-        points[i] = from_buffer<g1::affine_element>(data, i * sizeof(g1::affine_element));
-    }
-    return points;
+    return deserialize_bn254_g1_data(data, num_points);
 }
 
 g2::affine_element get_bn254_g2_data(const std::filesystem::path& path, bool allow_download)
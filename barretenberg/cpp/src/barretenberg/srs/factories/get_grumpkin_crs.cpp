@@ -1,6 +1,7 @@
 #include "get_grumpkin_crs.hpp"
 #include "barretenberg/api/exec_pipe.hpp"
 #include "barretenberg/api/file_io.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/common/try_catch_shim.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -21,6 +22,19 @@ std::vector<uint8_t> download_grumpkin_g1_data(size_t num_points)
 
     return data;
 }
+
+std::vector<bb::curve::Grumpkin::AffineElement> deserialize_grumpkin_g1_data(const std::vector<uint8_t>& data,
+                                                                            size_t num_points)
+{
+    using AffineElement = bb::curve::Grumpkin::AffineElement;
+    std::vector<AffineElement> points(num_points);
+    bb::parallel_for_range(num_points, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            points[i] = from_buffer<AffineElement>(data, i * sizeof(AffineElement));
+        }
+    });
+    return points;
+}
 } // namespace
 
 namespace bb {
@@ -36,10 +50,7 @@ std::vector<curve::Grumpkin::AffineElement> get_grumpkin_g1_data(const std::file
     if (g1_downloaded_points >= num_points) {
         vinfo("using cached grumpkin crs with num points ", g1_downloaded_points, " at: ", g1_path);
         auto data = read_file(g1_path, num_points * sizeof(curve::Grumpkin::AffineElement));
-        std::vector<curve::Grumpkin::AffineElement> points(num_points);
-        for (uint32_t i = 0; i < num_points; ++i) {
-            points[i] = from_buffer<curve::Grumpkin::AffineElement>(data, i * sizeof(curve::Grumpkin::AffineElement));
-        }
+        auto points = deserialize_grumpkin_g1_data(data, num_points);
         if (points[0].on_curve()) {
             return points;
         }
@@ -57,10 +68,6 @@ std::vector<curve::Grumpkin::AffineElement> get_grumpkin_g1_data(const std::file
     auto data = download_grumpkin_g1_data(num_points);
     write_file(path / "grumpkin_g1.flat.dat", data);
 
-    std::vector<curve::Grumpkin::AffineElement> points(num_points);
-    for (uint32_t i = 0; i < num_points; ++i) {
-        points[i] = from_buffer<curve::Grumpkin::AffineElement>(data, i * sizeof(curve::Grumpkin::AffineElement));
-    }
-    return points;
+    return deserialize_grumpkin_g1_data(data, num_points);
 }
 } // namespace bb
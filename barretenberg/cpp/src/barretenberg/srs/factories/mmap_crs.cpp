@@ -0,0 +1,257 @@
+#include "mmap_crs.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/pairing.hpp"
+#include <cstring>
+#include <fstream>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using namespace bb;
+using namespace bb::srs::factories;
+
+// Bump whenever the in-memory representation of field or group elements changes.
+constexpr uint64_t NATIVE_CRS_VERSION = 1;
+constexpr uint64_t BN254_CACHE_MAGIC = 0x62622d63727362ULL;
+constexpr uint64_t GRUMPKIN_CACHE_MAGIC = 0x62622d63727367ULL;
+
+struct NativeCrsHeader {
+    uint64_t magic;
+    uint64_t version;
+    uint64_t point_size;
+    uint64_t num_points;
+    uint64_t reserved[4]; // NOLINT
+};
+// The header must preserve the 64 byte alignment of the affine elements that follow it.
+static_assert(sizeof(NativeCrsHeader) == 64);
+
+template <typename AffineElement> constexpr uint64_t cache_magic()
+{
+    if constexpr (std::is_same_v<AffineElement, curve::BN254::AffineElement>) {
+        return BN254_CACHE_MAGIC;
+    } else {
+        return GRUMPKIN_CACHE_MAGIC;
+    }
+}
+
+/**
+ * @brief Owns a private (copy-on-write) mapping of a native-layout CRS cache file.
+ */
+template <typename AffineElement> class MappedPoints {
+  public:
+    MappedPoints(const MappedPoints&) = delete;
+    MappedPoints(MappedPoints&&) = delete;
+    MappedPoints& operator=(const MappedPoints&) = delete;
+    MappedPoints& operator=(MappedPoints&&) = delete;
+
+    ~MappedPoints()
+    {
+#ifndef __wasm__
+        munmap(base_, mapped_size_);
+#endif
+    }
+
+    static std::unique_ptr<MappedPoints> open([[maybe_unused]] const std::filesystem::path& cache_path,
+                                              [[maybe_unused]] size_t num_points)
+    {
+#ifdef __wasm__
+        return nullptr;
+#else
+        int fd = ::open(cache_path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            return nullptr;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(NativeCrsHeader)) {
+            close(fd);
+            return nullptr;
+        }
+        NativeCrsHeader header;
+        if (pread(fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)) ||
+            header.magic != cache_magic<AffineElement>() || header.version != NATIVE_CRS_VERSION ||
+            header.point_size != sizeof(AffineElement) || header.num_points == 0 || header.num_points < num_points ||
+            static_cast<size_t>(st.st_size) < sizeof(NativeCrsHeader) + header.num_points * sizeof(AffineElement)) {
+            close(fd);
+            return nullptr;
+        }
+        size_t mapped_size = sizeof(NativeCrsHeader) + header.num_points * sizeof(AffineElement);
+        // MAP_PRIVATE keeps the pages shared with the page cache (and other processes) until someone writes to them.
+        void* base = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) {
+            return nullptr;
+        }
+        auto* points = reinterpret_cast<AffineElement*>(static_cast<uint8_t*>(base) + sizeof(NativeCrsHeader));
+        if (!points[0].on_curve()) {
+            munmap(base, mapped_size);
+            return nullptr;
+        }
+        return std::unique_ptr<MappedPoints>(new MappedPoints(base, mapped_size, header.num_points));
+#endif
+    }
+
+    std::span<AffineElement> points() const
+    {
+        return { reinterpret_cast<AffineElement*>(static_cast<uint8_t*>(base_) + sizeof(NativeCrsHeader)),
+                 num_points_ };
+    }
+
+  private:
+    MappedPoints(void* base, size_t mapped_size, size_t num_points)
+        : base_(base)
+        , mapped_size_(mapped_size)
+        , num_points_(num_points)
+    {}
+
+    void* base_;
+    size_t mapped_size_;
+    size_t num_points_;
+};
+
+class MmapBn254Crs : public Crs<curve::BN254> {
+    using Curve = curve::BN254;
+
+  public:
+    MmapBn254Crs(const MmapBn254Crs&) = delete;
+    MmapBn254Crs(MmapBn254Crs&&) noexcept = delete;
+    MmapBn254Crs& operator=(const MmapBn254Crs&) = delete;
+    MmapBn254Crs& operator=(MmapBn254Crs&&) = delete;
+
+    MmapBn254Crs(std::unique_ptr<MappedPoints<Curve::AffineElement>> mapping, g2::affine_element const& g2_point)
+        : g2_x(g2_point)
+        , precomputed_g2_lines(
+              static_cast<pairing::miller_lines*>(aligned_alloc(64, sizeof(bb::pairing::miller_lines) * 2)))
+        , mapping_(std::move(mapping))
+    {
+        bb::pairing::precompute_miller_lines(bb::g2::one, precomputed_g2_lines[0]);
+        bb::pairing::precompute_miller_lines(g2_x, precomputed_g2_lines[1]);
+    }
+
+    ~MmapBn254Crs() override { aligned_free(precomputed_g2_lines); }
+
+    std::span<Curve::AffineElement> get_monomial_points() override { return mapping_->points(); }
+
+    size_t get_monomial_size() const override { return mapping_->points().size(); }
+
+    g2::affine_element get_g2x() const override { return g2_x; }
+
+    pairing::miller_lines const* get_precomputed_g2_lines() const override { return precomputed_g2_lines; }
+    g1::affine_element get_g1_identity() const override { return mapping_->points()[0]; };
+
+  private:
+    g2::affine_element g2_x;
+    pairing::miller_lines* precomputed_g2_lines;
+    std::unique_ptr<MappedPoints<Curve::AffineElement>> mapping_;
+};
+
+class MmapGrumpkinCrs : public Crs<curve::Grumpkin> {
+    using Curve = curve::Grumpkin;
+
+  public:
+    MmapGrumpkinCrs(const MmapGrumpkinCrs&) = delete;
+    MmapGrumpkinCrs(MmapGrumpkinCrs&&) noexcept = delete;
+    MmapGrumpkinCrs& operator=(const MmapGrumpkinCrs&) = delete;
+    MmapGrumpkinCrs& operator=(MmapGrumpkinCrs&&) = delete;
+
+    MmapGrumpkinCrs(std::unique_ptr<MappedPoints<Curve::AffineElement>> mapping)
+        : mapping_(std::move(mapping))
+    {}
+
+    ~MmapGrumpkinCrs() override = default;
+    std::span<Curve::AffineElement> get_monomial_points() override { return mapping_->points(); }
+    size_t get_monomial_size() const override { return mapping_->points().size(); }
+    Curve::AffineElement get_g1_identity() const override { return mapping_->points()[0]; };
+
+  private:
+    std::unique_ptr<MappedPoints<Curve::AffineElement>> mapping_;
+};
+
+} // namespace
+
+namespace bb::srs::factories {
+
+std::filesystem::path bn254_native_cache_path(const std::filesystem::path& path)
+{
+    return path / "bn254_g1.native.dat";
+}
+
+std::filesystem::path grumpkin_native_cache_path(const std::filesystem::path& path)
+{
+    return path / "grumpkin_g1.native.dat";
+}
+
+std::shared_ptr<Crs<curve::BN254>> open_mmap_bn254_crs(const std::filesystem::path& cache_path,
+                                                       size_t num_points,
+                                                       g2::affine_element const& g2_point)
+{
+    auto mapping = MappedPoints<curve::BN254::AffineElement>::open(cache_path, num_points);
+    if (mapping == nullptr) {
+        return nullptr;
+    }
+    vinfo("mapped native bn254 crs with num points ", mapping->points().size(), " at ", cache_path);
+    return std::make_shared<MmapBn254Crs>(std::move(mapping), g2_point);
+}
+
+std::shared_ptr<Crs<curve::Grumpkin>> open_mmap_grumpkin_crs(const std::filesystem::path& cache_path,
+                                                             size_t num_points)
+{
+    auto mapping = MappedPoints<curve::Grumpkin::AffineElement>::open(cache_path, num_points);
+    if (mapping == nullptr) {
+        return nullptr;
+    }
+    vinfo("mapped native grumpkin crs with num points ", mapping->points().size(), " at ", cache_path);
+    return std::make_shared<MmapGrumpkinCrs>(std::move(mapping));
+}
+
+template <typename AffineElement>
+bool write_native_crs_cache([[maybe_unused]] const std::filesystem::path& cache_path,
+                            [[maybe_unused]] std::span<const AffineElement> points)
+{
+#ifdef __wasm__
+    return false;
+#else
+    NativeCrsHeader header{};
+    header.magic = cache_magic<AffineElement>();
+    header.version = NATIVE_CRS_VERSION;
+    header.point_size = sizeof(AffineElement);
+    header.num_points = points.size();
+
+    // Write next to the final location so that the rename below stays on one filesystem and is atomic.
+    auto tmp_path = cache_path;
+    tmp_path += ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(points.data()),
+                   static_cast<std::streamsize>(points.size() * sizeof(AffineElement)));
+        if (!file) {
+            std::error_code ec;
+            std::filesystem::remove(tmp_path, ec);
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, cache_path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+    return true;
+#endif
+}
+
+template bool write_native_crs_cache<curve::BN254::AffineElement>(const std::filesystem::path&,
+                                                                  std::span<const curve::BN254::AffineElement>);
+template bool write_native_crs_cache<curve::Grumpkin::AffineElement>(const std::filesystem::path&,
+                                                                     std::span<const curve::Grumpkin::AffineElement>);
+
+} // namespace bb::srs::factories
@@ -0,0 +1,49 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/bn254/g2.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "crs_factory.hpp"
+#include <filesystem>
+#include <memory>
+#include <span>
+
+namespace bb::srs::factories {
+
+/**
+ * @details The flat transcript files (bn254_g1.dat, grumpkin_g1.flat.dat) store points as big-endian integers, so
+ * every point has to be deserialized (and converted into Montgomery form) before it can be fed to pippenger. To avoid
+ * paying for this on every process start we keep a secondary cache file next to the transcript that holds the points
+ * exactly as they are laid out in memory:
+ *
+ *      | header (64 bytes) | AffineElement[0] | AffineElement[1] | ... | AffineElement[num_points - 1] |
+ *
+ * The cache is memory-mapped copy-on-write, so the points are never copied on load and several prover processes on
+ * the same host share the same page-cache pages.
+ */
+std::filesystem::path bn254_native_cache_path(const std::filesystem::path& path);
+std::filesystem::path grumpkin_native_cache_path(const std::filesystem::path& path);
+
+/**
+ * @brief Maps a native-layout BN254 G1 cache file that holds at least num_points points.
+ * @return nullptr if the cache is missing, stale or memory mapping is unavailable on this platform.
+ */
+std::shared_ptr<Crs<curve::BN254>> open_mmap_bn254_crs(const std::filesystem::path& cache_path,
+                                                       size_t num_points,
+                                                       g2::affine_element const& g2_point);
+
+/**
+ * @brief Maps a native-layout Grumpkin cache file that holds at least num_points points.
+ * @return nullptr if the cache is missing, stale or memory mapping is unavailable on this platform.
+ */
+std::shared_ptr<Crs<curve::Grumpkin>> open_mmap_grumpkin_crs(const std::filesystem::path& cache_path,
+                                                             size_t num_points);
+
+/**
+ * @brief Writes points to a native-layout cache file. The file is written to a temporary location and renamed into
+ * place, so concurrent readers never observe a partially written cache.
+ * @return false if the cache could not be written (e.g. read-only CRS directory).
+ */
+template <typename AffineElement>
+bool write_native_crs_cache(const std::filesystem::path& cache_path, std::span<const AffineElement> points);
+
+} // namespace bb::srs::factories
@@ -2,6 +2,7 @@
 #include "barretenberg/srs/factories/get_bn254_crs.hpp"
 #include "barretenberg/srs/factories/get_grumpkin_crs.hpp"
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
+#include "barretenberg/srs/factories/mmap_crs.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
 namespace bb::srs::factories {
@@ -35,4 +36,47 @@ MemGrumpkinCrsFactory init_grumpkin_crs(const std::filesystem::path& path,
     auto grumpkin_g1_data = get_grumpkin_g1_data(path, eccvm_dyadic_circuit_size, allow_download);
     return { grumpkin_g1_data };
 }
+
+std::shared_ptr<Crs<curve::BN254>> NativeBn254CrsFactory::get_crs(size_t degree)
+{
+    // The mapped CRS may hold more points than were ever requested, so only reload when it is actually too small.
+    if (crs_ != nullptr && crs_->get_monomial_size() >= degree) {
+        return crs_;
+    }
+    auto g2_point = get_bn254_g2_data(path_);
+    auto cache_path = bn254_native_cache_path(path_);
+    crs_ = open_mmap_bn254_crs(cache_path, degree, g2_point);
+    if (crs_ != nullptr) {
+        return crs_;
+    }
+    auto points = get_bn254_g1_data(path_, degree, allow_download_);
+    if (write_native_crs_cache<g1::affine_element>(cache_path, points)) {
+        crs_ = open_mmap_bn254_crs(cache_path, degree, g2_point);
+    }
+    // Fall back to an in-memory CRS when the cache can't be written or mapped (read-only CRS directory, wasm).
+    if (crs_ == nullptr) {
+        crs_ = MemBn254CrsFactory(points, g2_point).get_crs(degree);
+    }
+    return crs_;
+}
+
+std::shared_ptr<Crs<curve::Grumpkin>> NativeGrumpkinCrsFactory::get_crs(size_t degree)
+{
+    if (crs_ != nullptr && crs_->get_monomial_size() >= degree) {
+        return crs_;
+    }
+    auto cache_path = grumpkin_native_cache_path(path_);
+    crs_ = open_mmap_grumpkin_crs(cache_path, degree);
+    if (crs_ != nullptr) {
+        return crs_;
+    }
+    auto points = get_grumpkin_g1_data(path_, degree, allow_download_);
+    if (write_native_crs_cache<curve::Grumpkin::AffineElement>(cache_path, points)) {
+        crs_ = open_mmap_grumpkin_crs(cache_path, degree);
+    }
+    if (crs_ == nullptr) {
+        crs_ = MemGrumpkinCrsFactory(points).get_crs(degree);
+    }
+    return crs_;
+}
 } // namespace bb::srs::factories
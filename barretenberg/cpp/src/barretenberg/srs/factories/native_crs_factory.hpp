@@ -31,6 +31,8 @@ MemGrumpkinCrsFactory init_grumpkin_crs(const std::filesystem::path& path,
 
 /**
  * Derives reference strings from a file, that is secondarily backed by the network.
+ * @details The first time a CRS of a given size is requested the flat transcript is deserialized once and written to a
+ * native-layout cache (see mmap_crs.hpp). Every later request, in this or any other process, maps that cache directly.
  */
 class NativeBn254CrsFactory : public CrsFactory<curve::BN254> {
   public:
@@ -38,20 +40,12 @@ class NativeBn254CrsFactory : public CrsFactory<curve::BN254> {
         : path_(path)
         , allow_download_(allow_download)
     {}
-    std::shared_ptr<Crs<curve::BN254>> get_crs(size_t degree) override
-    {
-        if (degree > last_degree_ || mem_crs_ == nullptr) {
-            mem_crs_ = std::make_shared<MemBn254CrsFactory>(init_bn254_crs(path_, degree, allow_download_));
-            last_degree_ = degree;
-        }
-        return mem_crs_->get_crs(degree);
-    }
+    std::shared_ptr<Crs<curve::BN254>> get_crs(size_t degree) override;
 
   private:
     std::filesystem::path path_;
     bool allow_download_ = true;
-    size_t last_degree_ = 0;
-    std::shared_ptr<MemBn254CrsFactory> mem_crs_;
+    std::shared_ptr<Crs<curve::BN254>> crs_;
 };
 
 class NativeGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
@@ -61,20 +55,12 @@ class NativeGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
         , allow_download_(allow_download)
     {}
 
-    std::shared_ptr<Crs<curve::Grumpkin>> get_crs(size_t degree) override
-    {
-        if (degree > last_degree_ || mem_crs_ == nullptr) {
-            mem_crs_ = std::make_unique<MemGrumpkinCrsFactory>(init_grumpkin_crs(path_, degree, allow_download_));
-            last_degree_ = degree;
-        }
-        return mem_crs_->get_crs(degree);
-    }
+    std::shared_ptr<Crs<curve::Grumpkin>> get_crs(size_t degree) override;
 
   private:
     std::filesystem::path path_;
     bool allow_download_ = true;
-    size_t last_degree_ = 0;
-    std::unique_ptr<MemGrumpkinCrsFactory> mem_crs_;
+    std::shared_ptr<Crs<curve::Grumpkin>> crs_;
 };
 
 } // namespace bb::srs::factories
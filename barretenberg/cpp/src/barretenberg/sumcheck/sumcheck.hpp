@@ -173,11 +173,20 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
     // prover instantiates sumcheck with circuit size and a prover transcript
-    SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
+    // active_row_ranges optionally describes the rows outside of which every relation vanishes (e.g. the active blocks
+    // of a structured trace); by default the union of the supports of the polynomials is used
+    SumcheckProver(size_t multivariate_n,
+                   const std::shared_ptr<Transcript>& transcript,
+                   const std::vector<std::pair<size_t, size_t>>& active_row_ranges = {})
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
         , transcript(transcript)
-        , round(multivariate_n){};
+        , round(multivariate_n)
+    {
+        if (!active_row_ranges.empty()) {
+            round.set_active_row_ranges(active_row_ranges);
+        }
+    };
 
     /**
      * @brief Non-ZK version: Compute round univariate, place it in transcript, compute challenge, partially evaluate.
@@ -195,6 +204,9 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
                                  const std::vector<FF>& gate_challenges)
     {
         bb::GateSeparatorPolynomial<FF> gate_separators(gate_challenges, multivariate_d);
+        if (round.active_edge_ranges.empty()) {
+            round.set_active_row_ranges_from_supports(full_polynomials);
+        }
 
         multivariate_challenge.reserve(multivariate_d);
         // In the first round, we compute the first univariate polynomial and populate the book-keeping table of
@@ -286,6 +298,9 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
         }
 
         bb::GateSeparatorPolynomial<FF> gate_separators(gate_challenges, multivariate_d);
+        if (round.active_edge_ranges.empty()) {
+            round.set_active_row_ranges_from_supports(full_polynomials);
+        }
         vinfo("starting sumcheck rounds...");
 
         multivariate_challenge.reserve(multivariate_d);
@@ -167,6 +167,56 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
         }
     }
 
+    /**
+     * @brief Check that restricting sumcheck to the active rows of a sparse trace does not change the proof, whether
+     * the rows are given explicitly or derived from the supports of the polynomials.
+     */
+    void test_active_ranges()
+    {
+        const size_t multivariate_d(10);
+        const size_t multivariate_n(1 << multivariate_d);
+        const std::vector<std::pair<size_t, size_t>> active_rows = { { 37, 300 }, { 701, 777 } };
+
+        // Polynomials that are random on the active rows and zero elsewhere, stored with support [37, 777)
+        std::vector<Polynomial<FF>> sparse_polynomials(NUM_POLYNOMIALS);
+        for (auto& poly : sparse_polynomials) {
+            poly = Polynomial<FF>(/*size=*/740, /*virtual_size=*/multivariate_n, /*start_index=*/37);
+            for (const auto& [start, end] : active_rows) {
+                for (size_t i = start; i < end; ++i) {
+                    poly.at(i) = FF::random_element();
+                }
+            }
+        }
+
+        auto prove = [&](const std::vector<std::pair<size_t, size_t>>& ranges) {
+            auto full_polynomials = construct_ultra_full_polynomials(sparse_polynomials);
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript, ranges);
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            return sumcheck.prove(full_polynomials, {}, alpha, gate_challenges);
+        };
+
+        auto all_edges = prove({ { 0, multivariate_n } });
+        auto explicit_ranges = prove(active_rows);
+        auto from_supports = prove({});
+
+        // The challenges are derived from the round univariates, so equal challenges mean equal proofs
+        EXPECT_EQ(all_edges.challenge, explicit_ranges.challenge);
+        EXPECT_EQ(all_edges.challenge, from_supports.challenge);
+        for (auto [expected, eval] : zip_view(all_edges.claimed_evaluations.get_all(),
+                                              explicit_ranges.claimed_evaluations.get_all())) {
+            EXPECT_EQ(expected, eval);
+        }
+    }
+
     // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
     void test_prover_verifier_flow()
     {
@@ -410,6 +460,14 @@ TYPED_TEST(SumcheckTests, Prover)
 {
     this->test_prover();
 }
+TYPED_TEST(SumcheckTests, ActiveRanges)
+{
+    if constexpr (!TypeParam::HasZK) {
+        this->test_active_ranges();
+    } else {
+        GTEST_SKIP() << "Skipping test for ZK-enabled flavors";
+    }
+}
 // Tests the prover-verifier flow
 TYPED_TEST(SumcheckTests, ProverAndVerifierSimple)
 {
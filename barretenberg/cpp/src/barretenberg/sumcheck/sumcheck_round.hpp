@@ -7,6 +7,7 @@
 #pragma once
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/flavor.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/polynomials/gate_separator.hpp"
 #include "barretenberg/polynomials/row_disabling_polynomial.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
@@ -14,6 +15,8 @@
 #include "barretenberg/relations/utils.hpp"
 #include "barretenberg/stdlib/primitives/bool/bool.hpp"
 #include "zk_sumcheck_data.hpp"
+#include <algorithm>
+#include <vector>
 
 namespace bb {
 
@@ -59,6 +62,15 @@ template <typename Flavor> class SumcheckProverRound {
      * @brief In Round \f$i = 0,\ldots, d-1\f$, equals \f$2^{d-i}\f$.
      */
     size_t round_size;
+    /**
+     * @brief Equals \f$2^d\f$, the round size of Round \f$0\f$.
+     */
+    size_t initial_round_size;
+    /**
+     * @brief Sorted, disjoint ranges \f$[start, end)\f$ of the edges of Round \f$0\f$ that may contribute to the
+     * round univariates. All other edges are skipped. Empty means that every edge is active.
+     */
+    std::vector<std::pair<size_t, size_t>> active_edge_ranges;
     /**
      * @brief Number of batched sub-relations in \f$F\f$ specified by Flavor.
      *
@@ -84,6 +96,7 @@ template <typename Flavor> class SumcheckProverRound {
     // Prover constructor
     SumcheckProverRound(size_t initial_round_size)
         : round_size(initial_round_size)
+        , initial_round_size(initial_round_size)
     {
 
         PROFILE_THIS_NAME("SumcheckProverRound constructor");
@@ -92,6 +105,87 @@ template <typename Flavor> class SumcheckProverRound {
         Utils::zero_univariates(univariate_accumulators);
     }
 
+    /**
+     * @brief Restrict the computation of the round univariates to the edges that touch the given rows of the full
+     * polynomials.
+     * @details The caller guarantees that every relation vanishes identically on any edge lying outside of the rows,
+     * e.g. because all polynomials are zero there, as in the unused part of a structured trace. The edge \f$(2k,
+     * 2k+1)\f$ also reads the shifted polynomials at rows \f$2k+1\f$ and \f$2k+2\f$, so a range starting at row
+     * \f$s\f$ activates the edge containing row \f$s-1\f$. Row \f$k\f$ of the partially evaluated polynomials is the fold
+     * of edge \f$2k\f$ of the previous round, hence the active edges of later rounds follow from those of Round
+     * \f$0\f$ (see get_round_edge_ranges).
+     *
+     * @param row_ranges Ranges \f$[start, end)\f$ of rows; they may overlap and need not be sorted.
+     */
+    void set_active_row_ranges(const std::vector<std::pair<size_t, size_t>>& row_ranges)
+    {
+        active_edge_ranges.clear();
+        for (const auto& [start, end] : row_ranges) {
+            const size_t first_edge = (start > 0 ? start - 1 : 0) & ~static_cast<size_t>(1);
+            const size_t end_edge = std::min(initial_round_size, ((end - 1) & ~static_cast<size_t>(1)) + 2);
+            if (start < end && first_edge < end_edge) {
+                active_edge_ranges.emplace_back(first_edge, end_edge);
+            }
+        }
+        std::sort(active_edge_ranges.begin(), active_edge_ranges.end());
+        std::vector<std::pair<size_t, size_t>> merged_ranges;
+        for (const auto& range : active_edge_ranges) {
+            if (!merged_ranges.empty() && range.first <= merged_ranges.back().second) {
+                merged_ranges.back().second = std::max(merged_ranges.back().second, range.second);
+            } else {
+                merged_ranges.push_back(range);
+            }
+        }
+        active_edge_ranges = std::move(merged_ranges);
+        // An empty description means "everything", so record an all-zero trace as a single empty edge range instead
+        if (active_edge_ranges.empty()) {
+            active_edge_ranges.emplace_back(0, 0);
+        }
+    }
+
+    /**
+     * @brief Restrict the computation of the round univariates to the union of the supports \f$[start\_index,
+     * end\_index)\f$ of the polynomials. Outside of it all polynomials are zero.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    void set_active_row_ranges_from_supports(const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials)
+    {
+        std::vector<std::pair<size_t, size_t>> supports;
+        for (const auto& poly : polynomials.get_all()) {
+            supports.emplace_back(poly.start_index(), poly.end_index());
+        }
+        set_active_row_ranges(supports);
+    }
+
+    /**
+     * @brief The active edges of the current round, as sorted disjoint ranges.
+     * @details Row \f$r\f$ in Round \f$i\f$ folds rows \f$[r \cdot 2^i, (r+1) \cdot 2^i)\f$ of Round \f$0\f$, so
+     * it is active iff one of the Round \f$0\f$ edges covering these rows is active.
+     */
+    std::vector<std::pair<size_t, size_t>> get_round_edge_ranges() const
+    {
+        if (active_edge_ranges.empty()) {
+            return { { 0, round_size } };
+        }
+        const size_t round_idx = static_cast<size_t>(numeric::get_msb(initial_round_size / round_size));
+        std::vector<std::pair<size_t, size_t>> edge_ranges;
+        for (const auto& [start, end] : active_edge_ranges) {
+            if (start == end) {
+                continue;
+            }
+            const size_t first_row = start >> round_idx;
+            const size_t last_row = (end - 1) >> round_idx;
+            const size_t first_edge = first_row & ~static_cast<size_t>(1);
+            const size_t end_edge = std::min(round_size, (last_row & ~static_cast<size_t>(1)) + 2);
+            if (!edge_ranges.empty() && first_edge <= edge_ranges.back().second) {
+                edge_ranges.back().second = std::max(edge_ranges.back().second, end_edge);
+            } else {
+                edge_ranges.emplace_back(first_edge, end_edge);
+            }
+        }
+        return edge_ranges;
+    }
+
     /**
      * @brief  To compute the round univariate in Round \f$i\f$, the prover first computes the values of Honk
      polynomials \f$ P_1,\ldots, P_N \f$ at the points of the form \f$ (u_0,\ldots, u_{i-1}, k, \vec \ell)\f$ for \f$
@@ -170,6 +264,12 @@ template <typename Flavor> class SumcheckProverRound {
     {
         PROFILE_THIS_NAME("compute_univariate");
 
+        const auto edge_ranges = get_round_edge_ranges();
+        if (edge_ranges.size() != 1 || edge_ranges[0] != std::pair<size_t, size_t>{ 0, round_size }) {
+            return compute_univariate_over_active_edges(
+                polynomials, relation_parameters, gate_separators, alpha, edge_ranges);
+        }
+
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
@@ -277,6 +377,70 @@ template <typename Flavor> class SumcheckProverRound {
         return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
     }
 
+    /**
+     * @brief Version of compute_univariate that only visits the given edges; the others must contribute nothing.
+     * @details The active edges are enumerated as if they were contiguous and distributed over the threads in portions.
+     * As in compute_univariate, flavors specifying MAX_CHUNK_THREAD_PORTION_SIZE get small portions assigned
+     * round-robin, so that threads share the dense and the sparse parts of the trace; other flavors give each thread
+     * one contiguous portion.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    SumcheckRoundUnivariate compute_univariate_over_active_edges(
+        ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::GateSeparatorPolynomial<FF>& gate_separators,
+        const RelationSeparator alpha,
+        const std::vector<std::pair<size_t, size_t>>& edge_ranges)
+    {
+        // edges_before[j] is the number of active edges in the ranges preceding range j
+        std::vector<size_t> edges_before(edge_ranges.size() + 1, 0);
+        for (size_t j = 0; j < edge_ranges.size(); ++j) {
+            edges_before[j + 1] = edges_before[j] + (edge_ranges[j].second - edge_ranges[j].first) / 2;
+        }
+        const size_t num_active_edges = edges_before.back();
+
+        if (num_active_edges > 0) {
+            size_t min_iterations_per_thread = 1 << 6;
+            size_t num_threads = bb::calculate_num_threads(2 * num_active_edges, min_iterations_per_thread);
+            size_t portion_size = (num_active_edges + num_threads - 1) / num_threads;
+            if constexpr (specifiesUnivariateChunks<Flavor>) {
+                portion_size = std::min(portion_size, Flavor::MAX_CHUNK_THREAD_PORTION_SIZE / 2);
+            }
+            const size_t num_portions = (num_active_edges + portion_size - 1) / portion_size;
+
+            std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
+            parallel_for(num_threads, [&](size_t thread_idx) {
+                Utils::zero_univariates(thread_univariate_accumulators[thread_idx]);
+                ExtendedEdges extended_edges;
+                for (size_t portion_idx = thread_idx; portion_idx < num_portions; portion_idx += num_threads) {
+                    const size_t begin = portion_idx * portion_size;
+                    const size_t end = std::min(begin + portion_size, num_active_edges);
+                    // Locate the range containing the first active edge of the portion
+                    size_t range_idx = static_cast<size_t>(
+                        std::upper_bound(edges_before.begin(), edges_before.end(), begin) - edges_before.begin() - 1);
+                    for (size_t active_edge = begin; active_edge < end; ++active_edge) {
+                        while (active_edge >= edges_before[range_idx + 1]) {
+                            range_idx++;
+                        }
+                        const size_t edge_idx =
+                            edge_ranges[range_idx].first + 2 * (active_edge - edges_before[range_idx]);
+                        extend_edges(extended_edges, polynomials, edge_idx);
+                        accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                        extended_edges,
+                                                        relation_parameters,
+                                                        gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
+                    }
+                }
+            });
+
+            for (auto& accumulators : thread_univariate_accumulators) {
+                Utils::add_nested_tuples(univariate_accumulators, accumulators);
+            }
+        }
+
+        return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
+    }
+
     /**
      * @brief In the de-facto mode of of operation for ZK, we add a randomising contribution via the Libra technique to
      * hide the actual round univariate and also ensure the total contribution is amended to take into account
@@ -66,18 +66,18 @@ void TranslatorProver::commit_to_witness_polynomial(Polynomial& polynomial, cons
  */
 void TranslatorProver::execute_wire_and_sorted_constraints_commitments_round()
 {
-
-    for (const auto& [wire, label] :
-         zip_view(key->proving_key->polynomials.get_wires(), commitment_labels.get_wires())) {
-
-        commit_to_witness_polynomial(wire, label);
-    }
-
-    // The ordered range constraints are of full circuit size.
-    for (const auto& [ordered_range_constraint, label] :
-         zip_view(key->proving_key->polynomials.get_ordered_range_constraints(),
-                  commitment_labels.get_ordered_range_constraints())) {
-        commit_to_witness_polynomial(ordered_range_constraint, label);
+    // The wires and the ordered range constraints (which are of full circuit size) are independent, so all of them are
+    // committed to with one batched MSM.
+    auto& polynomials = key->proving_key->polynomials;
+    RefVector<Polynomial> to_commit = concatenate(RefVector<Polynomial>(polynomials.get_wires()),
+                                                  RefVector<Polynomial>(polynomials.get_ordered_range_constraints()));
+    RefVector<std::string> labels =
+        concatenate(RefVector<std::string>(commitment_labels.get_wires()),
+                    RefVector<std::string>(commitment_labels.get_ordered_range_constraints()));
+
+    auto commitments = key->proving_key->commitment_key.batch_commit(to_commit);
+    for (const auto& [commitment, label] : zip_view(commitments, labels)) {
+        transcript->send_to_verifier(label, commitment);
     }
 }
 
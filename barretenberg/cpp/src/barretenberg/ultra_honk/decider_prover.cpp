@@ -35,7 +35,7 @@ template <IsUltraOrMegaHonk Flavor> void DeciderProver_<Flavor>::execute_relatio
 {
     using Sumcheck = SumcheckProver<Flavor>;
     size_t polynomial_size = proving_key->proving_key.circuit_size;
-    auto sumcheck = Sumcheck(polynomial_size, transcript);
+    auto sumcheck = Sumcheck(polynomial_size, transcript, proving_key->relation_active_ranges);
     {
 
         PROFILE_THIS_NAME("sumcheck.prove");
@@ -334,6 +334,34 @@ void DeciderProvingKey_<Flavor>::move_structured_trace_overflow_to_overflow_bloc
     }
 }
 
+/**
+ * @brief Determine the rows of the trace on which the relations can be non-trivial
+ * @details These are the rows of the gate blocks plus the rows holding the lookup tables, the databus columns and the
+ * masking at the end of the trace. On every other row the wires, selectors, sigmas and ids vanish and the grand
+ * product is constant, so every relation is zero there. Sumcheck uses this to skip the unused parts of (in particular
+ * structured) traces, in the same way the ExecutionTraceUsageTracker active ranges are used by Protogalaxy.
+ */
+template <IsUltraOrMegaHonk Flavor>
+void DeciderProvingKey_<Flavor>::construct_relation_active_ranges(const Circuit& circuit)
+{
+    relation_active_ranges = proving_key.active_region_data.get_ranges();
+    // The zero row, where lagrange_first is supported
+    relation_active_ranges.emplace_back(0, 1);
+
+    const size_t tables_start = circuit.blocks.lookup.trace_offset;
+    relation_active_ranges.emplace_back(tables_start, tables_start + circuit.get_tables_size());
+
+    if constexpr (HasDataBus<Flavor>) {
+        const size_t databus_size = std::max({ circuit.get_calldata().size(),
+                                               circuit.get_secondary_calldata().size(),
+                                               circuit.get_return_data().size() });
+        relation_active_ranges.emplace_back(0, databus_size);
+    }
+
+    // Masked rows (ZK flavors) and the rows that the row-disabling polynomial accounts for
+    relation_active_ranges.emplace_back(dyadic_circuit_size - NUM_DISABLED_ROWS_IN_SUMCHECK, dyadic_circuit_size);
+}
+
 template class DeciderProvingKey_<UltraFlavor>;
 template class DeciderProvingKey_<UltraZKFlavor>;
 template class DeciderProvingKey_<UltraKeccakFlavor>;
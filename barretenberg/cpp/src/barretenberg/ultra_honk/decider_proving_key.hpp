@@ -60,6 +60,9 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
 
     size_t overflow_size{ 0 }; // size of the structured execution trace overflow
 
+    // Rows outside of which every relation vanishes identically; sumcheck skips all other edges. Empty means unknown.
+    std::vector<std::pair<size_t, size_t>> relation_active_ranges;
+
     DeciderProvingKey_(Circuit& circuit,
                        TraceSettings trace_settings = {},
                        CommitmentKey commitment_key = CommitmentKey())
@@ -164,6 +167,8 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
                                                  circuit,
                                                  dyadic_circuit_size);
         }
+
+        construct_relation_active_ranges(circuit);
         { // Public inputs handling
             // Construct the public inputs array
             for (size_t i = 0; i < proving_key.num_public_inputs; ++i) {
@@ -278,6 +283,8 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
     void construct_databus_polynomials(Circuit&)
         requires HasDataBus<Flavor>;
 
+    void construct_relation_active_ranges(const Circuit&);
+
     static void move_structured_trace_overflow_to_overflow_block(Circuit& circuit)
         requires IsMegaFlavor<Flavor>;
 };
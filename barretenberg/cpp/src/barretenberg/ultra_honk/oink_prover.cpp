@@ -107,40 +107,40 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_preamble_ro
 template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_wire_commitments_round()
 {
     PROFILE_THIS_NAME("OinkProver::execute_wire_commitments_round");
+    auto& polynomials = proving_key->proving_key.polynomials;
+
     // Commit to the first three wire polynomials
     // We only commit to the fourth wire polynomial after adding memory recordss
-    {
-        PROFILE_THIS_NAME("COMMIT::wires");
-        auto commit_type = (proving_key->get_is_structured()) ? CommitmentKey::CommitType::Structured
-                                                              : CommitmentKey::CommitType::Default;
-
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.w_l, commitment_labels.w_l, commit_type);
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.w_r, commitment_labels.w_r, commit_type);
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.w_o, commitment_labels.w_o, commit_type);
-    }
+    RefVector<Polynomial<FF>> wires{ polynomials.w_l, polynomials.w_r, polynomials.w_o };
+    std::vector<std::string> labels{ commitment_labels.w_l, commitment_labels.w_r, commitment_labels.w_o };
 
     if constexpr (IsMegaFlavor<Flavor>) {
-
         // Commit to Goblin ECC op wires.
         // To avoid possible issues with the current work on the merge protocol, they are not
         // masked in MegaZKFlavor
-        for (auto [polynomial, label] :
-             zip_view(proving_key->proving_key.polynomials.get_ecc_op_wires(), commitment_labels.get_ecc_op_wires())) {
-            {
-                PROFILE_THIS_NAME("COMMIT::ecc_op_wires");
-                transcript->send_to_verifier(domain_separator + label,
-                                             proving_key->proving_key.commitment_key.commit(polynomial));
-            };
+        RefVector<Polynomial<FF>> ecc_op_wires = polynomials.get_ecc_op_wires();
+        for (auto& label : commitment_labels.get_ecc_op_wires()) {
+            labels.emplace_back(label);
         }
 
         // Commit to DataBus related polynomials
-        for (auto [polynomial, label] : zip_view(proving_key->proving_key.polynomials.get_databus_entities(),
-                                                 commitment_labels.get_databus_entities())) {
-            {
-                PROFILE_THIS_NAME("COMMIT::databus");
-                commit_to_witness_polynomial(polynomial, label);
+        RefVector<Polynomial<FF>> databus_entities = polynomials.get_databus_entities();
+        for (auto& label : commitment_labels.get_databus_entities()) {
+            labels.emplace_back(label);
+        }
+
+        // All of these commitments are independent, so they are computed in a single batch. Since the ECC op wires
+        // are part of it, the other polynomials are masked here rather than by the batch.
+        if constexpr (Flavor::HasZK) {
+            for (auto& polynomial : concatenate(wires, databus_entities)) {
+                polynomial.mask();
             }
         }
+        PROFILE_THIS_NAME("COMMIT::wires_ecc_op_wires_databus");
+        commit_to_witness_polynomials(concatenate(wires, ecc_op_wires, databus_entities), labels, /*mask=*/false);
+    } else {
+        PROFILE_THIS_NAME("COMMIT::wires");
+        commit_to_witness_polynomials(wires, labels);
     }
 }
 
@@ -160,23 +160,15 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_sorted_list
 
     WitnessComputation<Flavor>::add_ram_rom_memory_records_to_wire_4(proving_key->proving_key, eta, eta_two, eta_three);
 
-    // Commit to lookup argument polynomials and the finalized (i.e. with memory records) fourth wire polynomial
-    {
-        PROFILE_THIS_NAME("COMMIT::lookup_counts_tags");
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.lookup_read_counts,
-                                     commitment_labels.lookup_read_counts,
-                                     CommitmentKey::CommitType::Sparse);
-
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.lookup_read_tags,
-                                     commitment_labels.lookup_read_tags,
-                                     CommitmentKey::CommitType::Sparse);
-    }
+    // Commit to lookup argument polynomials and the finalized (i.e. with memory records) fourth wire polynomial. The
+    // sparse read counts and tags cost only their nonzero entries in the batched MSM.
     {
-        PROFILE_THIS_NAME("COMMIT::wires");
-        auto commit_type = (proving_key->get_is_structured()) ? CommitmentKey::CommitType::Structured
-                                                              : CommitmentKey::CommitType::Default;
-        commit_to_witness_polynomial(
-            proving_key->proving_key.polynomials.w_4, domain_separator + commitment_labels.w_4, commit_type);
+        PROFILE_THIS_NAME("COMMIT::lookup_counts_tags_w_4");
+        auto& polynomials = proving_key->proving_key.polynomials;
+        commit_to_witness_polynomials({ polynomials.lookup_read_counts, polynomials.lookup_read_tags, polynomials.w_4 },
+                                      { commitment_labels.lookup_read_counts,
+                                        commitment_labels.lookup_read_tags,
+                                        domain_separator + commitment_labels.w_4 });
     }
 }
 
@@ -195,22 +187,19 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_log_derivat
     WitnessComputation<Flavor>::compute_logderivative_inverses(proving_key->proving_key,
                                                                proving_key->relation_parameters);
 
+    // If Mega, also commit to the databus inverse polynomials, in the same batch
     {
         PROFILE_THIS_NAME("COMMIT::lookup_inverses");
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.lookup_inverses,
-                                     commitment_labels.lookup_inverses,
-                                     CommitmentKey::CommitType::Sparse);
-    }
-
-    // If Mega, commit to the databus inverse polynomials and send
-    if constexpr (IsMegaFlavor<Flavor>) {
-        for (auto [polynomial, label] : zip_view(proving_key->proving_key.polynomials.get_databus_inverses(),
-                                                 commitment_labels.get_databus_inverses())) {
-            {
-                PROFILE_THIS_NAME("COMMIT::databus_inverses");
-                commit_to_witness_polynomial(polynomial, label, CommitmentKey::CommitType::Sparse);
+        RefVector<Polynomial<FF>> inverses{ proving_key->proving_key.polynomials.lookup_inverses };
+        std::vector<std::string> labels{ commitment_labels.lookup_inverses };
+        if constexpr (IsMegaFlavor<Flavor>) {
+            inverses = concatenate(
+                inverses, RefVector<Polynomial<FF>>(proving_key->proving_key.polynomials.get_databus_inverses()));
+            for (auto& label : commitment_labels.get_databus_inverses()) {
+                labels.emplace_back(label);
             }
-        };
+        }
+        commit_to_witness_polynomials(inverses, labels);
     }
 }
 
@@ -272,6 +261,34 @@ void OinkProver<Flavor>::commit_to_witness_polynomial(Polynomial<FF>& polynomial
     transcript->send_to_verifier(domain_separator + label, commitment);
 }
 
+/**
+ * @brief Mask (unless told otherwise), commit to and send several independent polynomials, using one batched MSM.
+ * @details The commitments are sent in the order of the polynomials.
+ *
+ * @param polynomials
+ * @param labels
+ * @param mask whether to mask the polynomials when proving in zero-knowledge
+ */
+template <IsUltraOrMegaHonk Flavor>
+void OinkProver<Flavor>::commit_to_witness_polynomials(RefVector<Polynomial<FF>> polynomials,
+                                                       const std::vector<std::string>& labels,
+                                                       bool mask)
+{
+    BB_ASSERT_EQ(polynomials.size(), labels.size());
+    if constexpr (Flavor::HasZK) {
+        if (mask) {
+            for (auto& polynomial : polynomials) {
+                polynomial.mask();
+            }
+        }
+    }
+
+    auto commitments = proving_key->proving_key.commitment_key.batch_commit(polynomials);
+    for (size_t i = 0; i < commitments.size(); ++i) {
+        transcript->send_to_verifier(domain_separator + labels[i], commitments[i]);
+    }
+}
+
 template class OinkProver<UltraFlavor>;
 template class OinkProver<UltraZKFlavor>;
 template class OinkProver<UltraKeccakFlavor>;
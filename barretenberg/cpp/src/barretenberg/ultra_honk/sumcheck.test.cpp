@@ -163,7 +163,8 @@ TEST_F(SumcheckTestsRealCircuit, Ultra)
     }
 
     decider_pk->alphas = prover_alphas;
-    auto sumcheck_prover = SumcheckProver<Flavor>(circuit_size, prover_transcript);
+    auto sumcheck_prover =
+        SumcheckProver<Flavor>(circuit_size, prover_transcript, decider_pk->relation_active_ranges);
     std::vector<FF> prover_gate_challenges(log_circuit_size);
     for (size_t idx = 0; idx < log_circuit_size; idx++) {
         prover_gate_challenges[idx] =
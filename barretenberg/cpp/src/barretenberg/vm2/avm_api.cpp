@@ -12,6 +12,16 @@ using namespace bb::avm2::simulation;
 
 std::pair<AvmAPI::AvmProof, AvmAPI::AvmVerificationKey> AvmAPI::prove(const AvmAPI::ProvingInputs& inputs)
 {
+#if !defined(NO_MULTITHREADING) && defined(WORK_STEALING_MULTITHREADING)
+    // Simulate and generate trace. Part of the trace is generated while simulation is still running.
+    info("Simulating and generating trace...");
+    AvmSimulationHelper simulation_helper(inputs.hints);
+    AvmTraceGenHelper tracegen_helper;
+    auto trace = tracegen_helper.simulate_and_generate_trace(simulation_helper, inputs.publicInputs);
+#else
+    // Without the work-stealing backend the streamed builders would run inline on the simulation thread, serially and
+    // without the parallel_for that generate_trace uses, so we simulate first and generate the trace afterwards.
+
     // Simulate.
     info("Simulating...");
     AvmSimulationHelper simulation_helper(inputs.hints);
@@ -22,6 +32,7 @@ std::pair<AvmAPI::AvmProof, AvmAPI::AvmVerificationKey> AvmAPI::prove(const AvmA
     AvmTraceGenHelper tracegen_helper;
     auto trace =
         AVM_TRACK_TIME_V("tracegen/all", tracegen_helper.generate_trace(std::move(events), inputs.publicInputs));
+#endif
 
     // Prove.
     info("Proving...");
@@ -44,7 +55,7 @@ bool AvmAPI::check_circuit(const AvmAPI::ProvingInputs& inputs)
     // before trying to run the interaction builders.
     info("Generating trace...");
     AvmTraceGenHelper tracegen_helper;
-    tracegen::TraceContainer trace;
+    tracegen::TraceContainer trace(tracegen::TraceContainer::Backend::DENSE);
     tracegen_helper.fill_trace_columns(trace, std::move(events), inputs.publicInputs);
 
     // Go into interactive debug mode if requested.
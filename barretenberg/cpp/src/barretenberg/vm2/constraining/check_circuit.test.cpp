@@ -0,0 +1,22 @@
+#include "barretenberg/vm2/constraining/check_circuit.hpp"
+#include "barretenberg/vm2/constraining/polynomials.hpp"
+#include "barretenberg/vm2/testing/fixtures.hpp"
+
+#include <gtest/gtest.h>
+
+namespace bb::avm2::constraining {
+namespace {
+
+// Runs every relation and lookup check, including the log-derivative inverses, from inside parallel_for.
+// Nothing reached from those checks may start a nested parallel_for, which aborts with the default thread pool.
+TEST(AvmCheckCircuitTest, MinimalTrace)
+{
+    auto [trace, public_inputs] = testing::get_minimal_trace_with_pi();
+    const size_t num_rows = trace.get_num_rows_without_clk() + 1;
+
+    auto polynomials = compute_polynomials(trace);
+    EXPECT_NO_THROW(run_check_circuit(polynomials, num_rows));
+}
+
+} // namespace
+} // namespace bb::avm2::constraining
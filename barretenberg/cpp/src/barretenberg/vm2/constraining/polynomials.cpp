@@ -22,6 +22,11 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
                            auto& poly = to_be_shifted[i];
                            // WARNING! Column-Polynomials order matters!
                            Column col = static_cast<Column>(TO_BE_SHIFTED_COLUMNS_ARRAY.at(i));
+                           if (trace.is_column_claimed(col)) {
+                               // Already allocated as a shiftable polynomial and filled in by tracegen.
+                               poly = trace.release_column(col);
+                               continue;
+                           }
                            uint32_t num_rows = trace.get_column_rows(col);
                            // Since we are shifting, we need to allocate one less row.
                            // The first row is always zero.
@@ -54,6 +59,10 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
 
                            // WARNING! Column-Polynomials order matters!
                            Column col = static_cast<Column>(i);
+                           if (trace.is_column_claimed(col)) {
+                               poly = trace.release_column(col);
+                               return;
+                           }
                            const auto num_rows = trace.get_column_rows(col);
                            poly = AvmProver::Polynomial::create_non_parallel_zero_init(num_rows, CIRCUIT_SUBGROUP_SIZE);
                        });
@@ -48,11 +48,13 @@ void AvmProver::execute_preamble_round()
 void AvmProver::execute_wire_commitments_round()
 {
     // Commit to all polynomials (apart from logderivative inverse polynomials, which are committed to in the later
-    // logderivative phase)
+    // logderivative phase). The columns are independent, so they go through one batched MSM; most of them are
+    // selectors or small-range limbs, for which the MSM skips the rounds above their bit width.
     auto wire_polys = prover_polynomials.get_wires();
     const auto& labels = prover_polynomials.get_wires_labels();
+    auto commitments = commitment_key.batch_commit(RefVector<Polynomial>(wire_polys));
     for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
-        transcript->send_to_verifier(labels[idx], commitment_key.commit(wire_polys[idx]));
+        transcript->send_to_verifier(labels[idx], commitments[idx]);
     }
 }
 
@@ -78,8 +80,9 @@ void AvmProver::execute_log_derivative_inverse_round()
 void AvmProver::execute_log_derivative_inverse_commitments_round()
 {
     // Commit to all logderivative inverse polynomials
-    for (auto [commitment, key_poly] : zip_view(witness_commitments.get_derived(), key->get_derived())) {
-        commitment = commitment_key.commit(key_poly);
+    auto commitments = commitment_key.batch_commit(RefVector<Polynomial>(key->get_derived()));
+    for (auto [commitment, computed] : zip_view(witness_commitments.get_derived(), commitments)) {
+        commitment = computed;
     }
 
     // Send all commitments to the verifier
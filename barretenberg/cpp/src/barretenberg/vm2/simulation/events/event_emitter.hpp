@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cassert>
+#include <functional>
 #include <vector>
 
 #include "barretenberg/vm2/common/set.hpp"
@@ -16,19 +17,53 @@ template <typename Event> class EventEmitterInterface {
     virtual void emit(Event&& event) = 0;
 };
 
+// Receives events in batches, in emission order.
+template <typename Event> using EventBatchConsumer = std::function<void(std::vector<Event>&&)>;
+
 template <typename Event> class EventEmitter : public EventEmitterInterface<Event> {
   public:
     using Container = std::vector<Event>;
+    static constexpr size_t DEFAULT_BATCH_SIZE = 1 << 12;
 
     virtual ~EventEmitter() = default;
-    void emit(Event&& event) override { events.push_back(std::move(event)); };
+    void emit(Event&& event) override
+    {
+        events.push_back(std::move(event));
+        if (batch_consumer && events.size() >= batch_size) {
+            flush();
+        }
+    };
+
+    // From now on, hands events over to the consumer every batch_size events instead of keeping them.
+    void stream_to(EventBatchConsumer<Event> consumer, size_t size = DEFAULT_BATCH_SIZE)
+    {
+        batch_consumer = std::move(consumer);
+        batch_size = size;
+        events.reserve(batch_size);
+    }
 
     const Container& get_events() const { return events; }
     // Transfers ownership of the events to the caller (clears the internal container).
-    Container dump_events() { return std::move(events); }
+    // If streaming, the remaining events go to the consumer instead and the result is empty.
+    Container dump_events()
+    {
+        flush();
+        return std::move(events);
+    }
 
   private:
+    void flush()
+    {
+        if (batch_consumer && !events.empty()) {
+            batch_consumer(std::move(events));
+            events = {};
+            events.reserve(batch_size);
+        }
+    }
+
     Container events;
+    EventBatchConsumer<Event> batch_consumer;
+    size_t batch_size = DEFAULT_BATCH_SIZE;
 };
 
 // This is an EventEmitter that eagerly deduplicates events based on a provided key.
@@ -63,6 +98,7 @@ template <typename Event> class NoopEventEmitter : public EventEmitterInterface<
 
     void emit(Event&&) override{};
     // TODO: Get rid of this.
+    void stream_to(EventBatchConsumer<Event>, size_t = 0){};
     EventEmitter<Event>::Container dump_events() { return {}; };
 };
 
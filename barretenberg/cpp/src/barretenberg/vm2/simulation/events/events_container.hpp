@@ -62,4 +62,16 @@ struct EventsContainer {
     EventEmitterInterface<NoteHashTreeCheckEvent>::Container note_hash_tree_check_events;
 };
 
+// Consumers for the event types that can be turned into trace rows while simulation is still running. Events of a
+// type with a consumer are handed over in batches as they are emitted, and are missing from the EventsContainer.
+// The trace builders for these types take a start_row and return the row after the last one they wrote: feeding that
+// back in as the start_row of the next call appends each batch right below the previous one.
+struct EventStreams {
+    EventBatchConsumer<BitwiseEvent> bitwise;
+    EventBatchConsumer<Poseidon2PermutationEvent> poseidon2_permutation;
+    EventBatchConsumer<ToRadixEvent> to_radix;
+    EventBatchConsumer<FieldGreaterThanEvent> field_gt;
+    EventBatchConsumer<MerkleCheckEvent> merkle_check;
+};
+
 } // namespace bb::avm2::simulation
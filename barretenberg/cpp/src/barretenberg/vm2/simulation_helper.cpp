@@ -72,7 +72,7 @@ struct FastSettings {
 
 } // namespace
 
-template <typename S> EventsContainer AvmSimulationHelper::simulate_with_settings()
+template <typename S> EventsContainer AvmSimulationHelper::simulate_with_settings(const EventStreams& streams)
 {
     typename S::template DefaultEventEmitter<ExecutionEvent> execution_emitter;
     typename S::template DefaultDeduplicatingEventEmitter<AluEvent> alu_emitter;
@@ -105,6 +105,17 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
     typename S::template DefaultEventEmitter<InternalCallStackEvent> internal_call_stack_emitter;
     typename S::template DefaultEventEmitter<NoteHashTreeCheckEvent> note_hash_tree_check_emitter;
 
+    auto stream_if_requested = [](auto& emitter, const auto& consumer) {
+        if (consumer) {
+            emitter.stream_to(consumer);
+        }
+    };
+    stream_if_requested(bitwise_emitter, streams.bitwise);
+    stream_if_requested(poseidon2_perm_emitter, streams.poseidon2_permutation);
+    stream_if_requested(to_radix_emitter, streams.to_radix);
+    stream_if_requested(field_gt_emitter, streams.field_gt);
+    stream_if_requested(merkle_check_emitter, streams.merkle_check);
+
     uint64_t current_timestamp = hints.tx.globalVariables.timestamp;
 
     ExecutionIdManager execution_id_manager(1);
@@ -206,12 +217,17 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
 
 EventsContainer AvmSimulationHelper::simulate()
 {
-    return simulate_with_settings<ProvingSettings>();
+    return simulate_with_settings<ProvingSettings>({});
+}
+
+EventsContainer AvmSimulationHelper::simulate(const EventStreams& streams)
+{
+    return simulate_with_settings<ProvingSettings>(streams);
 }
 
 void AvmSimulationHelper::simulate_fast()
 {
-    simulate_with_settings<FastSettings>();
+    simulate_with_settings<FastSettings>({});
 }
 
 } // namespace bb::avm2
@@ -13,12 +13,15 @@ class AvmSimulationHelper {
 
     // Full simulation with event collection.
     simulation::EventsContainer simulate();
+    // Full simulation where the event types with a consumer in `streams` are handed over in batches while
+    // simulation is running, rather than collected.
+    simulation::EventsContainer simulate(const simulation::EventStreams& streams);
 
     // Fast simulation without event collection.
     void simulate_fast();
 
   private:
-    template <typename S> simulation::EventsContainer simulate_with_settings();
+    template <typename S> simulation::EventsContainer simulate_with_settings(const simulation::EventStreams& streams);
 
     ExecutionHints hints;
 };
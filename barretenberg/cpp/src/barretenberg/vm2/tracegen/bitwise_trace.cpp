@@ -14,15 +14,17 @@
 
 namespace bb::avm2::tracegen {
 
-void BitwiseTraceBuilder::process(const simulation::EventEmitterInterface<simulation::BitwiseEvent>::Container& events,
-                                  TraceContainer& trace)
+uint32_t BitwiseTraceBuilder::process(
+    const simulation::EventEmitterInterface<simulation::BitwiseEvent>::Container& events,
+    TraceContainer& trace,
+    uint32_t start_row)
 {
     using C = Column;
 
     // We activate last selector in the extra pre-pended row (to support shift)
     trace.set(C::bitwise_last, 0, 1);
 
-    uint32_t row = 1;
+    uint32_t row = start_row;
     for (const auto& event : events) {
         auto tag = event.a.get_tag();
         const auto start_ctr = integral_tag_length(tag);
@@ -61,6 +63,8 @@ void BitwiseTraceBuilder::process(const simulation::EventEmitterInterface<simula
             row++;
         }
     }
+
+    return row;
 }
 
 const InteractionDefinition BitwiseTraceBuilder::interactions =
@@ -12,6 +12,7 @@ namespace bb::avm2::tracegen {
 namespace {
 
 using testing::ElementsAre;
+using C = Column;
 
 TEST(BitwiseTraceGenTest, U1And)
 {
@@ -153,5 +154,46 @@ TEST(BitwiseTraceGenTest, U32And)
                                   ROW_FIELD_EQ(bitwise_start, 0))));
 }
 
+TEST(BitwiseTraceGenTest, BatchesAppendToEachOther)
+{
+    const std::vector<simulation::BitwiseEvent> events = {
+        {
+            .operation = BitwiseOperation::AND,
+            .a = MemoryValue::from<uint32_t>(0x52488425),
+            .b = MemoryValue::from<uint32_t>(0xC684486C),
+            .res = MemoryValue::from<uint32_t>(0x42000024),
+        },
+        {
+            .operation = BitwiseOperation::XOR,
+            .a = MemoryValue::from<uint16_t>(0x5248),
+            .b = MemoryValue::from<uint16_t>(0xC684),
+            .res = MemoryValue::from<uint16_t>(0x94CC),
+        },
+        {
+            .operation = BitwiseOperation::OR,
+            .a = MemoryValue::from(uint1_t(0)),
+            .b = MemoryValue::from(uint1_t(1)),
+            .res = MemoryValue::from(uint1_t(1)),
+        },
+    };
+
+    TestTraceContainer whole_trace;
+    const uint32_t end_row = BitwiseTraceBuilder().process(events, whole_trace);
+
+    TestTraceContainer batched_trace;
+    BitwiseTraceBuilder builder;
+    uint32_t row = builder.process({ events[0] }, batched_trace);
+    row = builder.process({ events[1], events[2] }, batched_trace, row);
+
+    EXPECT_EQ(row, end_row);
+    EXPECT_EQ(batched_trace.as_rows().size(), whole_trace.as_rows().size());
+    for (uint32_t i = 0; i < end_row; i++) {
+        for (auto col : { C::bitwise_op_id, C::bitwise_acc_ia, C::bitwise_acc_ib, C::bitwise_acc_ic, C::bitwise_ctr,
+                          C::bitwise_last, C::bitwise_sel, C::bitwise_start }) {
+            EXPECT_EQ(batched_trace.get(col, i), whole_trace.get(col, i));
+        }
+    }
+}
+
 } // namespace
 } // namespace bb::avm2::tracegen
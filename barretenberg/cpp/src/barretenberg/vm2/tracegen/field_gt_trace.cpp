@@ -12,13 +12,14 @@ namespace bb::avm2::tracegen {
 using simulation::LimbsComparisonWitness;
 using simulation::U256Decomposition;
 
-void FieldGreaterThanTraceBuilder::process(
+uint32_t FieldGreaterThanTraceBuilder::process(
     const simulation::EventEmitterInterface<simulation::FieldGreaterThanEvent>::Container& events,
-    TraceContainer& trace)
+    TraceContainer& trace,
+    uint32_t start_row)
 {
     using C = Column;
 
-    uint32_t row = 1;
+    uint32_t row = start_row;
     for (const auto& event : events) {
         // Copy the things that will need range checks since we'll mutate them in the shifts
         U256Decomposition a_limbs = event.a_limbs;
@@ -79,6 +80,8 @@ void FieldGreaterThanTraceBuilder::process(
             cmp_rng_ctr--;
         }
     }
+
+    return row;
 }
 
 const InteractionDefinition FieldGreaterThanTraceBuilder::interactions =
@@ -12,8 +12,9 @@ namespace bb::avm2::tracegen {
 
 class FieldGreaterThanTraceBuilder final {
   public:
-    void process(const simulation::EventEmitterInterface<simulation::FieldGreaterThanEvent>::Container& events,
-                 TraceContainer& trace);
+    uint32_t process(const simulation::EventEmitterInterface<simulation::FieldGreaterThanEvent>::Container& events,
+                     TraceContainer& trace,
+                     uint32_t start_row = 1);
 
     static const InteractionDefinition interactions;
 };
@@ -12,13 +12,15 @@ namespace bb::avm2::tracegen {
 
 using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
 
-void MerkleCheckTraceBuilder::process(
-    const simulation::EventEmitterInterface<simulation::MerkleCheckEvent>::Container& events, TraceContainer& trace)
+uint32_t MerkleCheckTraceBuilder::process(
+    const simulation::EventEmitterInterface<simulation::MerkleCheckEvent>::Container& events,
+    TraceContainer& trace,
+    uint32_t start_row)
 {
     using C = Column;
 
     // Skip 0th row since this gadget has shifts
-    uint32_t row = 1;
+    uint32_t row = start_row;
 
     for (const auto& event : events) {
         const size_t full_path_len = event.sibling_path.size();
@@ -90,6 +92,8 @@ void MerkleCheckTraceBuilder::process(
         assert(read_node == root);
         assert(write_node == new_root);
     }
+
+    return row;
 }
 
 const InteractionDefinition MerkleCheckTraceBuilder::interactions =
@@ -338,9 +338,10 @@ void Poseidon2TraceBuilder::process_hash(
     }
 }
 
-void Poseidon2TraceBuilder::process_permutation(
+uint32_t Poseidon2TraceBuilder::process_permutation(
     const simulation::EventEmitterInterface<simulation::Poseidon2PermutationEvent>::Container& perm_events,
-    TraceContainer& trace)
+    TraceContainer& trace,
+    uint32_t start_row)
 {
     using C = Column;
     // Our current state
@@ -348,7 +349,7 @@ void Poseidon2TraceBuilder::process_permutation(
     // These are where we will store the intermediate values of current_state in the trace.
     std::array<Column, 4> round_state_cols;
 
-    uint32_t row = 0;
+    uint32_t row = start_row;
 
     for (const auto& event : perm_events) {
         // The bulk of this code is a copy of the Poseidon2Permutation::permute function from bb
@@ -426,6 +427,8 @@ void Poseidon2TraceBuilder::process_permutation(
                   } });
         row++;
     }
+
+    return row;
 }
 
 const InteractionDefinition Poseidon2TraceBuilder::interactions =
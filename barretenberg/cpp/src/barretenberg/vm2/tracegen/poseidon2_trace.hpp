@@ -14,9 +14,10 @@ class Poseidon2TraceBuilder final {
   public:
     void process_hash(const simulation::EventEmitterInterface<simulation::Poseidon2HashEvent>::Container& hash_events,
                       TraceContainer& trace);
-    void process_permutation(
+    uint32_t process_permutation(
         const simulation::EventEmitterInterface<simulation::Poseidon2PermutationEvent>::Container& perm_events,
-        TraceContainer& trace);
+        TraceContainer& trace,
+        uint32_t start_row = 0);
 
     static const InteractionDefinition interactions;
 };
@@ -26,9 +26,10 @@ void PrecomputedTraceBuilder::process_misc(TraceContainer& trace, const uint32_t
 
     // Clk
     // TODO: What a waste of 64MB. Can we elegantly have a flag for this?
-    trace.reserve_column(C::precomputed_clk, num_rows);
-    for (uint32_t i = 0; i < num_rows; i++) {
-        trace.set(C::precomputed_clk, i, i);
+    // We own this column, so we write it straight into its polynomial.
+    auto& clk = trace.claim_column(C::precomputed_clk, num_rows);
+    for (size_t i = clk.start_index(); i < clk.end_index(); i++) {
+        clk.at(i) = i;
     }
 }
 
@@ -13,14 +13,16 @@
 
 namespace bb::avm2::tracegen {
 
-void ToRadixTraceBuilder::process(const simulation::EventEmitterInterface<simulation::ToRadixEvent>::Container& events,
-                                  TraceContainer& trace)
+uint32_t ToRadixTraceBuilder::process(
+    const simulation::EventEmitterInterface<simulation::ToRadixEvent>::Container& events,
+    TraceContainer& trace,
+    uint32_t start_row)
 {
     using C = Column;
 
     auto p_limbs_per_radix = get_p_limbs_per_radix();
 
-    uint32_t row = 1; // We start from row 1 because this trace contains shifted columns.
+    uint32_t row = start_row; // We start from row 1 because this trace contains shifted columns.
     for (const auto& event : events) {
         FF value = event.value;
         uint32_t radix = event.radix;
@@ -86,6 +88,8 @@ void ToRadixTraceBuilder::process(const simulation::EventEmitterInterface<simula
             exponent *= radix;
         }
     }
+
+    return row;
 }
 
 const InteractionDefinition ToRadixTraceBuilder::interactions =
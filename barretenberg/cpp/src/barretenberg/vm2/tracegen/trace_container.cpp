@@ -1,6 +1,12 @@
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
+#include <cstring>
+#include <stdexcept>
+
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/vm2/common/constants.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
 
@@ -11,14 +17,96 @@ namespace {
 static const FF zero = FF::zero();
 constexpr auto clk_column = Column::precomputed_clk;
 
+// Lock-free running maximum.
+void update_max(std::atomic<int64_t>& max, int64_t value)
+{
+    int64_t current = max.load(std::memory_order_relaxed);
+    while (current < value && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
 } // namespace
 
-TraceContainer::TraceContainer()
-    : trace(std::make_unique<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>())
-{}
+TraceContainer::DenseColumn::Position TraceContainer::DenseColumn::locate(uint32_t row)
+{
+    if (row < (1UL << LOG_FIRST_CHUNK_SIZE)) {
+        return { .chunk_index = 0, .offset = row, .chunk_size = 1UL << LOG_FIRST_CHUNK_SIZE };
+    }
+    if (row < (1UL << LOG_MAX_CHUNK_SIZE)) {
+        // Chunk k >= 1 holds rows [2^(k + LOG_FIRST_CHUNK_SIZE - 1), 2^(k + LOG_FIRST_CHUNK_SIZE)).
+        const auto log_chunk_start = static_cast<size_t>(numeric::get_msb(row));
+        return { .chunk_index = log_chunk_start - LOG_FIRST_CHUNK_SIZE + 1,
+                 .offset = row - (1UL << log_chunk_start),
+                 .chunk_size = 1UL << log_chunk_start };
+    }
+    if (row >= CIRCUIT_SUBGROUP_SIZE) {
+        throw std::runtime_error(format("Row ", row, " is out of range for a dense trace column"));
+    }
+    return { .chunk_index = NUM_GROWING_CHUNKS + (row >> LOG_MAX_CHUNK_SIZE) - 1,
+             .offset = row & ((1UL << LOG_MAX_CHUNK_SIZE) - 1),
+             .chunk_size = 1UL << LOG_MAX_CHUNK_SIZE };
+}
+
+const FF* TraceContainer::DenseColumn::find(uint32_t row) const
+{
+    if (row >= CIRCUIT_SUBGROUP_SIZE) {
+        return nullptr;
+    }
+    const auto [chunk_index, offset, chunk_size] = locate(row);
+    const FF* chunk = chunks[chunk_index].load(std::memory_order_acquire);
+    return chunk == nullptr ? nullptr : chunk + offset;
+}
+
+FF& TraceContainer::DenseColumn::get_or_allocate(uint32_t row)
+{
+    const auto [chunk_index, offset, chunk_size] = locate(row);
+    FF* chunk = chunks[chunk_index].load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+        const size_t chunk_bytes = sizeof(FF) * chunk_size;
+        auto* fresh = static_cast<FF*>(aligned_alloc(alignof(FF), chunk_bytes));
+        std::memset(static_cast<void*>(fresh), 0, chunk_bytes);
+        // Another thread may have raced us to allocate the same chunk, in which case we use theirs.
+        if (chunks[chunk_index].compare_exchange_strong(chunk, fresh, std::memory_order_acq_rel)) {
+            chunk = fresh;
+        } else {
+            aligned_free(fresh);
+        }
+    }
+    return chunk[offset];
+}
+
+void TraceContainer::DenseColumn::clear()
+{
+    for (auto& chunk : chunks) {
+        FF* data = chunk.exchange(nullptr);
+        if (data != nullptr) {
+            aligned_free(data);
+        }
+    }
+    max_row_number = -1;
+    row_number_dirty = false;
+}
+
+TraceContainer::TraceContainer(Backend backend)
+    : claimed_columns(std::make_unique<std::array<std::unique_ptr<Polynomial<FF>>, NUM_COLUMNS_WITHOUT_SHIFTS>>())
+    , backend(backend)
+{
+    if (backend == Backend::SPARSE) {
+        trace = std::make_unique<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>();
+    } else {
+        dense_trace = std::make_unique<std::array<DenseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>();
+    }
+}
 
 const FF& TraceContainer::get(Column col, uint32_t row) const
 {
+    if (const auto& claimed = (*claimed_columns)[static_cast<size_t>(col)]; claimed != nullptr) {
+        return claimed->get(row);
+    }
+    if (backend == Backend::DENSE) {
+        const FF* value = (*dense_trace)[static_cast<size_t>(col)].find(row);
+        return value == nullptr ? zero : *value;
+    }
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::shared_lock lock(column_data.mutex);
     const auto it = column_data.rows.find(row);
@@ -35,6 +123,30 @@ const FF& TraceContainer::get_column_or_shift(ColumnAndShifts col, uint32_t row)
 
 void TraceContainer::set(Column col, uint32_t row, const FF& value)
 {
+    if (auto& claimed = (*claimed_columns)[static_cast<size_t>(col)]; claimed != nullptr) {
+        if (row < claimed->start_index() || row >= claimed->end_index()) {
+            if (value.is_zero()) {
+                return;
+            }
+            throw std::runtime_error(
+                format("Row ", row, " is outside of claimed column ", COLUMN_NAMES.at(static_cast<size_t>(col))));
+        }
+        claimed->at(row) = value;
+        return;
+    }
+    if (backend == Backend::DENSE) {
+        auto& column_data = (*dense_trace)[static_cast<size_t>(col)];
+        if (!value.is_zero()) {
+            column_data.get_or_allocate(row) = value;
+            update_max(column_data.max_row_number, static_cast<int64_t>(row));
+        } else if (FF* existing = const_cast<FF*>(column_data.find(row)); existing != nullptr) {
+            *existing = value;
+            if (column_data.max_row_number == static_cast<int64_t>(row)) {
+                column_data.row_number_dirty = true;
+            }
+        }
+        return;
+    }
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
     if (!value.is_zero()) {
@@ -59,6 +171,10 @@ void TraceContainer::set(uint32_t row, std::span<const std::pair<Column, FF>> va
 
 void TraceContainer::reserve_column(Column col, size_t size)
 {
+    if (backend == Backend::DENSE || is_column_claimed(col)) {
+        // Dense chunks are allocated on demand, there is nothing to reserve.
+        return;
+    }
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
     column_data.rows.reserve(size);
@@ -66,6 +182,30 @@ void TraceContainer::reserve_column(Column col, size_t size)
 
 uint32_t TraceContainer::get_column_rows(Column col) const
 {
+    if (const auto& claimed = (*claimed_columns)[static_cast<size_t>(col)]; claimed != nullptr) {
+        size_t rows = claimed->end_index();
+        while (rows > claimed->start_index() && claimed->get(rows - 1).is_zero()) {
+            rows--;
+        }
+        return static_cast<uint32_t>(rows > claimed->start_index() ? rows : 0);
+    }
+    if (backend == Backend::DENSE) {
+        auto& column_data = (*dense_trace)[static_cast<size_t>(col)];
+        if (column_data.row_number_dirty) {
+            // Trigger recalculation of max row number by scanning down from the previous maximum.
+            int64_t row = column_data.max_row_number;
+            while (row >= 0) {
+                const FF* value = column_data.find(static_cast<uint32_t>(row));
+                if (value != nullptr && !value->is_zero()) {
+                    break;
+                }
+                row--;
+            }
+            column_data.max_row_number = row;
+            column_data.row_number_dirty = false;
+        }
+        return static_cast<uint32_t>(column_data.max_row_number + 1);
+    }
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
     if (column_data.row_number_dirty) {
@@ -97,6 +237,29 @@ uint32_t TraceContainer::get_num_rows() const
 
 void TraceContainer::visit_column(Column col, const std::function<void(uint32_t, const FF&)>& visitor) const
 {
+    if (const auto& claimed = (*claimed_columns)[static_cast<size_t>(col)]; claimed != nullptr) {
+        for (size_t row = claimed->start_index(); row < claimed->end_index(); row++) {
+            if (!claimed->get(row).is_zero()) {
+                visitor(static_cast<uint32_t>(row), claimed->get(row));
+            }
+        }
+        return;
+    }
+    if (backend == Backend::DENSE) {
+        const auto& column_data = (*dense_trace)[static_cast<size_t>(col)];
+        const auto num_rows = column_data.max_row_number + 1;
+        for (int64_t row = 0; row < num_rows; row++) {
+            const FF* value = column_data.find(static_cast<uint32_t>(row));
+            if (value == nullptr) {
+                // Skip the whole (unallocated) chunk.
+                const auto [chunk_index, offset, chunk_size] = DenseColumn::locate(static_cast<uint32_t>(row));
+                row += static_cast<int64_t>(chunk_size - offset) - 1;
+            } else if (!value->is_zero()) {
+                visitor(static_cast<uint32_t>(row), *value);
+            }
+        }
+        return;
+    }
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::shared_lock lock(column_data.mutex);
     for (const auto& [row, value] : column_data.rows) {
@@ -106,6 +269,11 @@ void TraceContainer::visit_column(Column col, const std::function<void(uint32_t,
 
 void TraceContainer::clear_column(Column col)
 {
+    (*claimed_columns)[static_cast<size_t>(col)].reset();
+    if (backend == Backend::DENSE) {
+        (*dense_trace)[static_cast<size_t>(col)].clear();
+        return;
+    }
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
     column_data.rows.clear();
@@ -113,4 +281,40 @@ void TraceContainer::clear_column(Column col)
     column_data.row_number_dirty = false;
 }
 
+Polynomial<FF>& TraceContainer::claim_column(Column col, uint32_t num_rows)
+{
+    auto& claimed = (*claimed_columns)[static_cast<size_t>(col)];
+    if (claimed != nullptr) {
+        throw std::runtime_error(format("Column ", COLUMN_NAMES.at(static_cast<size_t>(col)), " is already claimed"));
+    }
+    // The first row of a shifted column is always zero, and is not allocated (see compute_polynomials).
+    const size_t start_index = (shift_column(col).has_value() && num_rows > 0) ? 1 : 0;
+    // We don't zero the memory in parallel, since columns are usually claimed from within parallel tracegen jobs.
+    auto poly = std::make_unique<Polynomial<FF>>(
+        num_rows - start_index, CIRCUIT_SUBGROUP_SIZE, start_index, Polynomial<FF>::DontZeroMemory::FLAG);
+    std::memset(static_cast<void*>(poly->data()), 0, sizeof(FF) * poly->size());
+    // Carry over whatever was written before the claim.
+    visit_column(col, [&](uint32_t row, const FF& value) {
+        if (row < poly->start_index() || row >= poly->end_index()) {
+            throw std::runtime_error(
+                format("Row ", row, " is outside of claimed column ", COLUMN_NAMES.at(static_cast<size_t>(col))));
+        }
+        poly->at(row) = value;
+    });
+    clear_column(col);
+    claimed = std::move(poly);
+    return *claimed;
+}
+
+Polynomial<FF> TraceContainer::release_column(Column col)
+{
+    auto& claimed = (*claimed_columns)[static_cast<size_t>(col)];
+    if (claimed == nullptr) {
+        throw std::runtime_error(format("Column ", COLUMN_NAMES.at(static_cast<size_t>(col)), " is not claimed"));
+    }
+    Polynomial<FF> poly = std::move(*claimed);
+    claimed.reset();
+    return poly;
+}
+
 } // namespace bb::avm2::tracegen
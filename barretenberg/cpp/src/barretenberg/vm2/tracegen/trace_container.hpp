@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -9,6 +10,8 @@
 #include <span>
 #include <unordered_map>
 
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/vm2/common/constants.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/common/map.hpp"
 #include "barretenberg/vm2/constraining/flavor_settings.hpp"
@@ -21,7 +24,15 @@ namespace bb::avm2::tracegen {
 // Contention can only happen when concurrently accessing the same column.
 class TraceContainer {
   public:
-    TraceContainer();
+    enum class Backend {
+        // Columns are hash maps from row to value, each guarded by a mutex. Cheap for very sparse columns.
+        SPARSE,
+        // Columns are dense arrays, allocated in chunks as rows are written. Writes are lock-free.
+        // Rows must be smaller than CIRCUIT_SUBGROUP_SIZE.
+        DENSE,
+    };
+
+    explicit TraceContainer(Backend backend = Backend::SPARSE);
 
     const FF& get(Column col, uint32_t row) const;
     template <size_t N> std::array<FF, N> get_multiple(const std::array<ColumnAndShifts, N>& cols, uint32_t row) const
@@ -60,6 +71,15 @@ class TraceContainer {
     // Free column memory.
     void clear_column(Column col);
 
+    // Backs a column by its final polynomial, sized for rows [0, num_rows) (or [1, num_rows) if the column is shifted,
+    // since the first row of a shifted column is always zero). The caller must own the column: it should claim it
+    // before anyone else accesses it, and may then write directly into the returned polynomial (or keep using set()).
+    // compute_polynomials() adopts the polynomial as is, without copying it.
+    Polynomial<FF>& claim_column(Column col, uint32_t num_rows);
+    bool is_column_claimed(Column col) const { return (*claimed_columns)[static_cast<size_t>(col)] != nullptr; }
+    // Moves a claimed column out of the container. The column is left empty.
+    Polynomial<FF> release_column(Column col);
+
   private:
     // We use a mutex per column to allow for concurrent writes.
     // Observe that therefore concurrent write access to different columns is cheap.
@@ -77,6 +97,41 @@ class TraceContainer {
     // Even if the _content_ of each unordered_map is always heap-allocated, if we have 3k columns
     // we could unnecessarily put strain on the stack with sizeof(unordered_map) * 3k bytes.
     std::unique_ptr<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
+
+    // Rows are stored in chunks that are allocated on first write and published with a compare-and-swap, so no lock
+    // is ever taken. Chunks double in size up to MAX_CHUNK_SIZE rows, so that small columns stay small and large ones
+    // waste at most one chunk.
+    struct DenseColumn {
+        static constexpr size_t LOG_FIRST_CHUNK_SIZE = 8;
+        static constexpr size_t LOG_MAX_CHUNK_SIZE = 16;
+        static constexpr size_t NUM_GROWING_CHUNKS = LOG_MAX_CHUNK_SIZE - LOG_FIRST_CHUNK_SIZE + 1;
+        static constexpr size_t NUM_CHUNKS =
+            NUM_GROWING_CHUNKS + (CIRCUIT_SUBGROUP_SIZE >> LOG_MAX_CHUNK_SIZE) - 1;
+
+        struct Position {
+            size_t chunk_index;
+            size_t offset;
+            size_t chunk_size;
+        };
+        static Position locate(uint32_t row);
+
+        std::array<std::atomic<FF*>, NUM_CHUNKS> chunks{};
+        std::atomic<int64_t> max_row_number = -1; // We use -1 to indicate that the column is empty.
+        std::atomic<bool> row_number_dirty = false;
+
+        DenseColumn() = default;
+        DenseColumn(const DenseColumn&) = delete;
+        DenseColumn& operator=(const DenseColumn&) = delete;
+        ~DenseColumn() { clear(); }
+
+        const FF* find(uint32_t row) const;
+        FF& get_or_allocate(uint32_t row);
+        void clear();
+    };
+    std::unique_ptr<std::array<DenseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>> dense_trace;
+
+    std::unique_ptr<std::array<std::unique_ptr<Polynomial<FF>>, NUM_COLUMNS_WITHOUT_SHIFTS>> claimed_columns;
+    Backend backend;
 };
 
 } // namespace bb::avm2::tracegen
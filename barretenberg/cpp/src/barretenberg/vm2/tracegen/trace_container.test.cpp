@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/vm2/common/constants.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+using C = Column;
+
+class TraceContainerTest : public ::testing::TestWithParam<TraceContainer::Backend> {};
+
+std::map<uint32_t, FF> collect_column(const TraceContainer& trace, Column col)
+{
+    std::map<uint32_t, FF> values;
+    trace.visit_column(col, [&](uint32_t row, const FF& value) { values[row] = value; });
+    return values;
+}
+
+TEST_P(TraceContainerTest, SetAndGet)
+{
+    TraceContainer trace(GetParam());
+
+    EXPECT_EQ(trace.get(C::execution_sel, 0), 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 0);
+
+    // Rows that span several dense chunks, including one far away.
+    trace.set(C::execution_sel, 0, 1);
+    trace.set(C::execution_sel, 255, 2);
+    trace.set(C::execution_sel, 256, 3);
+    trace.set(C::execution_sel, 100000, 4);
+    trace.set(C::execution_sel, CIRCUIT_SUBGROUP_SIZE - 1, 5);
+
+    EXPECT_EQ(trace.get(C::execution_sel, 0), 1);
+    EXPECT_EQ(trace.get(C::execution_sel, 255), 2);
+    EXPECT_EQ(trace.get(C::execution_sel, 256), 3);
+    EXPECT_EQ(trace.get(C::execution_sel, 100000), 4);
+    EXPECT_EQ(trace.get(C::execution_sel, CIRCUIT_SUBGROUP_SIZE - 1), 5);
+    EXPECT_EQ(trace.get(C::execution_sel, 1), 0);
+    EXPECT_EQ(trace.get(C::execution_sel, 99999), 0);
+
+    std::map<uint32_t, FF> expected{
+        { 0, 1 }, { 255, 2 }, { 256, 3 }, { 100000, 4 }, { CIRCUIT_SUBGROUP_SIZE - 1, 5 }
+    };
+    EXPECT_EQ(collect_column(trace, C::execution_sel), expected);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), CIRCUIT_SUBGROUP_SIZE);
+
+    trace.set(C::execution_sel, CIRCUIT_SUBGROUP_SIZE - 1, 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 100001);
+    trace.set(C::execution_sel, 100000, 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 257);
+    EXPECT_EQ(trace.get_num_rows(), 257);
+
+    trace.clear_column(C::execution_sel);
+    EXPECT_EQ(trace.get(C::execution_sel, 0), 0);
+    EXPECT_TRUE(collect_column(trace, C::execution_sel).empty());
+}
+
+TEST(TraceContainerDenseTest, RowOutOfRange)
+{
+    TraceContainer trace(TraceContainer::Backend::DENSE);
+    EXPECT_THROW(trace.set(C::execution_sel, CIRCUIT_SUBGROUP_SIZE, 1), std::runtime_error);
+    EXPECT_EQ(trace.get(C::execution_sel, CIRCUIT_SUBGROUP_SIZE), 0);
+}
+
+TEST_P(TraceContainerTest, ConcurrentWritesToSameColumn)
+{
+    TraceContainer trace(GetParam());
+    constexpr uint32_t num_rows = 1 << 14;
+
+    parallel_for(num_rows, [&](size_t row) {
+        trace.set(C::execution_sel, static_cast<uint32_t>(row), FF(row + 1));
+        trace.set(C::execution_pc, static_cast<uint32_t>(row), FF(row));
+    });
+
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), num_rows);
+    EXPECT_EQ(trace.get_column_rows(C::execution_pc), num_rows);
+    for (uint32_t row = 0; row < num_rows; row++) {
+        EXPECT_EQ(trace.get(C::execution_sel, row), FF(row + 1));
+        EXPECT_EQ(trace.get(C::execution_pc, row), FF(row));
+    }
+}
+
+TEST_P(TraceContainerTest, ClaimedColumn)
+{
+    TraceContainer trace(GetParam());
+
+    // Values written before the claim are carried over.
+    trace.set(C::precomputed_clk, 3, 42);
+    auto& poly = trace.claim_column(C::precomputed_clk, 16);
+    EXPECT_TRUE(trace.is_column_claimed(C::precomputed_clk));
+    EXPECT_EQ(poly.virtual_size(), CIRCUIT_SUBGROUP_SIZE);
+    EXPECT_EQ(poly.end_index(), 16);
+    EXPECT_EQ(poly[3], 42);
+
+    // Writes through the polynomial and through the container are the same thing.
+    poly.at(5) = 7;
+    trace.set(C::precomputed_clk, 6, 8);
+    EXPECT_EQ(trace.get(C::precomputed_clk, 5), 7);
+    EXPECT_EQ(poly[6], 8);
+    EXPECT_EQ(trace.get_column_rows(C::precomputed_clk), 7);
+    EXPECT_THROW(trace.set(C::precomputed_clk, 16, 1), std::runtime_error);
+
+    auto released = trace.release_column(C::precomputed_clk);
+    EXPECT_FALSE(trace.is_column_claimed(C::precomputed_clk));
+    EXPECT_EQ(released[5], 7);
+    EXPECT_EQ(trace.get(C::precomputed_clk, 5), 0);
+}
+
+TEST_P(TraceContainerTest, ClaimedShiftedColumn)
+{
+    TraceContainer trace(GetParam());
+    const auto col = static_cast<Column>(TO_BE_SHIFTED_COLUMNS_ARRAY.at(0));
+
+    auto& poly = trace.claim_column(col, 16);
+    // The first row of a shifted column is not allocated.
+    EXPECT_EQ(poly.start_index(), 1);
+    EXPECT_EQ(poly.end_index(), 16);
+    trace.set(col, 0, 0);
+    EXPECT_THROW(trace.set(col, 0, 1), std::runtime_error);
+}
+
+INSTANTIATE_TEST_SUITE_P(TraceContainerTest,
+                         TraceContainerTest,
+                         ::testing::Values(TraceContainer::Backend::SPARSE, TraceContainer::Backend::DENSE));
+
+} // namespace
+} // namespace bb::avm2::tracegen
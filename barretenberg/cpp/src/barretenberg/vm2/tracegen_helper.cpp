@@ -1,7 +1,10 @@
 #include "barretenberg/vm2/tracegen_helper.hpp"
 
 #include <array>
+#include <deque>
+#include <exception>
 #include <functional>
+#include <mutex>
 #include <span>
 #include <string>
 #include <vector>
@@ -9,6 +12,7 @@
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/common/std_array.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/work_stealing.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/vm2/common/map.hpp"
 #include "barretenberg/vm2/constraining/flavor.hpp"
@@ -182,7 +186,7 @@ template <typename T> std::vector<T> concatenate_jobs(std::vector<T>&& first, au
 
 TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events, const PublicInputs& public_inputs)
 {
-    TraceContainer trace;
+    TraceContainer trace(TraceContainer::Backend::DENSE);
 
     fill_trace_columns(trace, std::move(events), public_inputs);
     fill_trace_interactions(trace);
@@ -193,6 +197,153 @@ TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events, const
     return trace;
 }
 
+namespace {
+
+// Processes the batches of one event type in the order in which they arrive. With the work-stealing backend, batches
+// of different event types are processed concurrently, with each other and with the simulation; otherwise spawn() runs
+// each batch inline as it arrives.
+template <typename Event> class OrderedBatchProcessor {
+  public:
+    using Batch = std::vector<Event>;
+
+    explicit OrderedBatchProcessor(std::function<void(const Batch&)> process_batch)
+        : process_batch(std::move(process_batch))
+    {}
+
+    OrderedBatchProcessor(const OrderedBatchProcessor&) = delete;
+    OrderedBatchProcessor(OrderedBatchProcessor&&) = delete;
+    OrderedBatchProcessor& operator=(const OrderedBatchProcessor&) = delete;
+    OrderedBatchProcessor& operator=(OrderedBatchProcessor&&) = delete;
+
+    // When simulation or another processor throws, drains can still be running and they reference this processor and
+    // the trace, so we wait for them here. Their errors are dropped since one is already propagating.
+    ~OrderedBatchProcessor() { wait_for_drains(); }
+
+    EventBatchConsumer<Event> consumer()
+    {
+        return [this](Batch&& batch) { push(std::move(batch)); };
+    }
+
+    // Waits until every batch pushed so far has been processed. Rethrows the first tracegen error.
+    void finish()
+    {
+        if (auto error = wait_for_drains()) {
+            std::rethrow_exception(error);
+        }
+    }
+
+  private:
+    std::exception_ptr wait_for_drains()
+    {
+        std::exception_ptr first_error;
+        for (auto& drain : drains) {
+            try {
+                drain.get();
+            } catch (...) {
+                if (!first_error) {
+                    first_error = std::current_exception();
+                }
+            }
+        }
+        drains.clear();
+        return first_error;
+    }
+
+    void push(Batch&& batch)
+    {
+        {
+            std::unique_lock lock(mutex);
+            pending.push_back(std::move(batch));
+            if (draining) {
+                return;
+            }
+            draining = true;
+        }
+        drains.push_back(spawn([this]() { drain(); }));
+    }
+
+    void drain()
+    {
+        while (true) {
+            Batch batch;
+            {
+                std::unique_lock lock(mutex);
+                if (pending.empty()) {
+                    draining = false;
+                    return;
+                }
+                batch = std::move(pending.front());
+                pending.pop_front();
+            }
+            process_batch(batch);
+        }
+    }
+
+    std::function<void(const Batch&)> process_batch;
+    std::mutex mutex;
+    std::deque<Batch> pending;
+    bool draining = false;
+    // Only touched by the thread that pushes batches.
+    std::vector<TaskFuture<void>> drains;
+};
+
+} // namespace
+
+TraceContainer AvmTraceGenHelper::simulate_and_generate_trace(AvmSimulationHelper& simulation_helper,
+                                                              const PublicInputs& public_inputs)
+{
+    TraceContainer trace(TraceContainer::Backend::DENSE);
+
+    // Each processor keeps its builder and the row where the next batch starts.
+    OrderedBatchProcessor<BitwiseEvent> bitwise(
+        [&, builder = BitwiseTraceBuilder(), row = uint32_t{ 1 }](const auto& batch) mutable {
+            AVM_TRACK_TIME("tracegen/bitwise", row = builder.process(batch, trace, row));
+        });
+    OrderedBatchProcessor<Poseidon2PermutationEvent> poseidon2_permutation(
+        [&, builder = Poseidon2TraceBuilder(), row = uint32_t{ 0 }](const auto& batch) mutable {
+            AVM_TRACK_TIME("tracegen/poseidon2_perm", row = builder.process_permutation(batch, trace, row));
+        });
+    OrderedBatchProcessor<ToRadixEvent> to_radix(
+        [&, builder = ToRadixTraceBuilder(), row = uint32_t{ 1 }](const auto& batch) mutable {
+            AVM_TRACK_TIME("tracegen/to_radix", row = builder.process(batch, trace, row));
+        });
+    OrderedBatchProcessor<FieldGreaterThanEvent> field_gt(
+        [&, builder = FieldGreaterThanTraceBuilder(), row = uint32_t{ 1 }](const auto& batch) mutable {
+            AVM_TRACK_TIME("tracegen/field_gt", row = builder.process(batch, trace, row));
+        });
+    OrderedBatchProcessor<MerkleCheckEvent> merkle_check(
+        [&, builder = MerkleCheckTraceBuilder(), row = uint32_t{ 1 }](const auto& batch) mutable {
+            AVM_TRACK_TIME("tracegen/merkle_check", row = builder.process(batch, trace, row));
+        });
+
+    EventStreams streams{
+        .bitwise = bitwise.consumer(),
+        .poseidon2_permutation = poseidon2_permutation.consumer(),
+        .to_radix = to_radix.consumer(),
+        .field_gt = field_gt.consumer(),
+        .merkle_check = merkle_check.consumer(),
+    };
+    auto events = AVM_TRACK_TIME_V("simulation/all", simulation_helper.simulate(streams));
+    AVM_TRACK_TIME("tracegen/streamed", {
+        bitwise.finish();
+        poseidon2_permutation.finish();
+        to_radix.finish();
+        field_gt.finish();
+        merkle_check.finish();
+    });
+
+    // The streamed event types are empty in `events`, everything else is generated as usual.
+    AVM_TRACK_TIME("tracegen/all", {
+        fill_trace_columns(trace, std::move(events), public_inputs);
+        fill_trace_interactions(trace);
+    });
+
+    check_interactions(trace);
+    print_trace_stats(trace);
+
+    return trace;
+}
+
 void AvmTraceGenHelper::fill_trace_columns(TraceContainer& trace,
                                            EventsContainer&& events,
                                            const PublicInputs& public_inputs)
@@ -408,7 +559,7 @@ void AvmTraceGenHelper::fill_trace_interactions(TraceContainer& trace)
 
 TraceContainer AvmTraceGenHelper::generate_precomputed_columns()
 {
-    TraceContainer trace;
+    TraceContainer trace(TraceContainer::Backend::DENSE);
     auto jobs = build_precomputed_columns_jobs(trace);
     execute_jobs(jobs);
     return trace;
@@ -2,6 +2,7 @@
 
 #include "barretenberg/vm2/common/avm_inputs.hpp"
 #include "barretenberg/vm2/simulation/events/events_container.hpp"
+#include "barretenberg/vm2/simulation_helper.hpp"
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
 namespace bb::avm2 {
@@ -11,6 +12,12 @@ class AvmTraceGenHelper {
     AvmTraceGenHelper() = default;
 
     tracegen::TraceContainer generate_trace(simulation::EventsContainer&& events, const PublicInputs& public_inputs);
+    // Runs the simulation and generates the trace in a pipeline: the events of the row-local subtraces are turned
+    // into trace rows in batches while simulation is still running, and are freed as soon as they are consumed.
+    // This only overlaps with simulation under the work-stealing backend (WORK_STEALING_MULTITHREADING); otherwise
+    // the batches are processed inline on the simulating thread, and AvmAPI::prove uses generate_trace instead.
+    tracegen::TraceContainer simulate_and_generate_trace(AvmSimulationHelper& simulation_helper,
+                                                         const PublicInputs& public_inputs);
     // These are useful for debugging.
     void fill_trace_columns(tracegen::TraceContainer& trace,
                             simulation::EventsContainer&& events,
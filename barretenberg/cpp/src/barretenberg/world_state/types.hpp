@@ -91,6 +91,22 @@ struct WorldStateStatusSummary {
     }
 };
 
+struct WorldStateForkStats {
+    // The number of open forks, not including the canonical fork
+    uint64_t numForks = 0;
+    // An estimate of the memory held by the uncommitted state of those forks
+    uint64_t overlayBytes = 0;
+    MSGPACK_FIELDS(numForks, overlayBytes);
+
+    bool operator==(const WorldStateForkStats& other) const = default;
+
+    friend std::ostream& operator<<(std::ostream& os, const WorldStateForkStats& stats)
+    {
+        os << "numForks: " << stats.numForks << ", overlayBytes: " << stats.overlayBytes;
+        return os;
+    }
+};
+
 struct WorldStateDBStats {
     TreeDBStats noteHashTreeStats;
     TreeDBStats messageTreeStats;
@@ -211,6 +211,27 @@ uint64_t WorldState::create_fork(const std::optional<block_number_t>& blockNumbe
     return forkId;
 }
 
+WorldStateForkStats WorldState::get_fork_stats() const
+{
+    std::vector<Fork::SharedPtr> forks;
+    {
+        std::unique_lock lock(mtx);
+        for (const auto& [id, fork] : _forks) {
+            if (id != CANONICAL_FORK_ID) {
+                forks.push_back(fork);
+            }
+        }
+    }
+    WorldStateForkStats stats{ .numForks = forks.size() };
+    for (const Fork::SharedPtr& fork : forks) {
+        for (const auto& [id, tree] : fork->_trees) {
+            stats.overlayBytes +=
+                std::visit([](auto&& wrapper) { return wrapper.tree->get_cache_memory_usage(); }, tree);
+        }
+    }
+    return stats;
+}
+
 void WorldState::remove_forks_for_block(const block_number_t& blockNumber)
 {
     // capture the shared pointers outside of the lock scope so we are not under the lock when the objects are destroyed
@@ -599,6 +620,23 @@ WorldStateStatusFull WorldState::sync_block(const StateReference& block_state_re
     }
     rollback();
 
+    apply_block_updates(block_state_ref, block_header_hash, notes, l1_to_l2_messages, nullifiers, public_writes);
+
+    std::pair<bool, std::string> result = commit(status);
+    if (!result.first) {
+        throw std::runtime_error(result.second);
+    }
+    populate_status_summary(status);
+    return status;
+}
+
+void WorldState::apply_block_updates(const StateReference& block_state_ref,
+                                     const bb::fr& block_header_hash,
+                                     const std::vector<bb::fr>& notes,
+                                     const std::vector<bb::fr>& l1_to_l2_messages,
+                                     const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
+                                     const std::vector<crypto::merkle_tree::PublicDataLeafValue>& public_writes)
+{
     Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
     Signal signal(static_cast<uint32_t>(fork->_trees.size()));
     std::atomic_bool success = true;
@@ -669,6 +707,70 @@ WorldStateStatusFull WorldState::sync_block(const StateReference& block_state_re
     if (!is_same_state_reference(WorldStateRevision::uncommitted(), block_state_ref)) {
         throw std::runtime_error("Can't synch block: block state does not match world state");
     }
+}
+
+void WorldState::stage_block()
+{
+    Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
+    Signal signal(static_cast<uint32_t>(fork->_trees.size()));
+    std::atomic_bool success = true;
+    std::string err_message;
+    for (auto& [id, tree] : fork->_trees) {
+        std::visit(
+            [&](auto&& wrapper) {
+                wrapper.tree->stage_block([&](const Response& resp) {
+                    // take the first error
+                    bool expected = true;
+                    if (!resp.success && success.compare_exchange_strong(expected, false)) {
+                        err_message = resp.message;
+                    }
+                    signal.signal_decrement();
+                });
+            },
+            tree);
+    }
+    signal.wait_for_level();
+
+    if (!success) {
+        throw std::runtime_error("Failed to stage block: " + err_message);
+    }
+}
+
+WorldStateStatusFull WorldState::sync_blocks(const std::vector<SyncBlockData>& blocks)
+{
+    if (blocks.empty()) {
+        throw std::runtime_error("Can't synch blocks: no blocks provided");
+    }
+    validate_trees_are_equally_synched();
+    WorldStateStatusFull status;
+    // As with sync_block, the first block may already be present in the uncommitted state
+    size_t first_to_apply = 0;
+    if (is_same_state_reference(WorldStateRevision::uncommitted(), blocks[0].blockStateRef) &&
+        is_archive_tip(WorldStateRevision::uncommitted(), blocks[0].blockHeaderHash)) {
+        first_to_apply = 1;
+    } else {
+        rollback();
+    }
+
+    try {
+        for (size_t i = first_to_apply; i < blocks.size(); ++i) {
+            // The previous block is complete, stage it and move straight on to the next
+            if (i > 0) {
+                stage_block();
+            }
+            const SyncBlockData& block = blocks[i];
+            apply_block_updates(block.blockStateRef,
+                                block.blockHeaderHash,
+                                block.notes,
+                                block.l1ToL2Messages,
+                                block.nullifiers,
+                                block.publicWrites);
+        }
+    } catch (std::exception&) {
+        // Don't leave staged blocks behind to be picked up by a later commit
+        rollback();
+        throw;
+    }
 
     std::pair<bool, std::string> result = commit(status);
     if (!result.first) {
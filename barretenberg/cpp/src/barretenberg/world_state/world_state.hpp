@@ -48,6 +48,18 @@ template <typename LeafValueType> struct SequentialInsertionResult {
     MSGPACK_FIELDS(low_leaf_witness_data, insertion_witness_data);
 };
 
+/**
+ * @brief The tree updates of a single block, as synched by WorldState::sync_blocks
+ */
+struct SyncBlockData {
+    StateReference blockStateRef;
+    bb::fr blockHeaderHash;
+    std::vector<bb::fr> notes;
+    std::vector<bb::fr> l1ToL2Messages;
+    std::vector<crypto::merkle_tree::NullifierLeafValue> nullifiers;
+    std::vector<crypto::merkle_tree::PublicDataLeafValue> publicWrites;
+};
+
 const uint64_t DEFAULT_MIN_NUMBER_OF_READERS = 128;
 
 /**
@@ -280,6 +292,13 @@ class WorldState {
     WorldStateStatusFull remove_historical_blocks(const block_number_t& toBlockNumber);
 
     void get_status_summary(WorldStateStatusSummary& status) const;
+
+    /**
+     * @brief Returns the number of open forks and an estimate of the memory held by their uncommitted state
+     * @details Forks read through to the committed state at their block, so this is the memory held by their own
+     * writes.
+     */
+    WorldStateForkStats get_fork_stats() const;
     WorldStateStatusFull sync_block(const StateReference& block_state_ref,
                                     const bb::fr& block_header_hash,
                                     const std::vector<bb::fr>& notes,
@@ -287,6 +306,15 @@ class WorldState {
                                     const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
                                     const std::vector<crypto::merkle_tree::PublicDataLeafValue>& public_writes);
 
+    /**
+     * @brief Synchs a run of consecutive blocks, committing them with a single write transaction per tree
+     * @details Each block is applied to the trees and validated as in sync_block, then staged rather than committed.
+     * The trees are committed once after the final block, so the cost of committing is paid once for the whole run
+     * and the updates for a block never wait on the commit of the previous one. If any block fails, none of the
+     * blocks are committed and the uncommitted state is rolled back.
+     */
+    WorldStateStatusFull sync_blocks(const std::vector<SyncBlockData>& blocks);
+
     void checkpoint(const uint64_t& forkId);
     void commit_checkpoint(const uint64_t& forkId);
     void revert_checkpoint(const uint64_t& forkId);
@@ -322,6 +350,15 @@ class WorldState {
 
     void validate_trees_are_equally_synched();
 
+    void apply_block_updates(const StateReference& block_state_ref,
+                             const bb::fr& block_header_hash,
+                             const std::vector<bb::fr>& notes,
+                             const std::vector<bb::fr>& l1_to_l2_messages,
+                             const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
+                             const std::vector<crypto::merkle_tree::PublicDataLeafValue>& public_writes);
+
+    void stage_block();
+
     WorldStateStatusFull attempt_tree_resync();
 
     static bool block_state_matches_world_state(const StateReference& block_state_ref,
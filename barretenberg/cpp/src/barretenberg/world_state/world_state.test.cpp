@@ -769,6 +769,95 @@ TEST_F(WorldStateTest, SyncEmptyBlock)
     EXPECT_EQ(indices, expected);
 }
 
+TEST_F(WorldStateTest, SyncMultipleBlocks)
+{
+    // Build the blocks with one world state and synch them all at once into another
+    std::string other_data_dir = random_temp_directory();
+    std::filesystem::create_directories(other_data_dir);
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    WorldState synched(
+        thread_pool_size, other_data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+
+    std::vector<SyncBlockData> blocks;
+    for (uint32_t i = 0; i < 4; i++) {
+        SyncBlockData block{
+            .blockHeaderHash = fr(1000 + i),
+            .notes = { fr(10 * i), fr(10 * i + 1) },
+            .l1ToL2Messages = { fr(10 * i + 2) },
+            .nullifiers = { NullifierLeafValue(1000 + i) },
+            .publicWrites = { PublicDataLeafValue(2000 + i, i + 1) },
+        };
+        ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, block.notes);
+        ws.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, block.l1ToL2Messages);
+        ws.append_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, block.nullifiers);
+        ws.append_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, block.publicWrites);
+        ws.append_leaves<fr>(MerkleTreeId::ARCHIVE, { block.blockHeaderHash });
+        block.blockStateRef = ws.get_state_reference(WorldStateRevision::uncommitted());
+        ws.sync_block(block.blockStateRef,
+                      block.blockHeaderHash,
+                      block.notes,
+                      block.l1ToL2Messages,
+                      block.nullifiers,
+                      block.publicWrites);
+        blocks.push_back(block);
+    }
+
+    WorldStateStatusFull status = synched.sync_blocks(blocks);
+    WorldStateStatusSummary expected{ 4, 0, 1, true };
+    EXPECT_EQ(status.summary, expected);
+    EXPECT_EQ(synched.get_state_reference(WorldStateRevision::committed()),
+              ws.get_state_reference(WorldStateRevision::committed()));
+
+    // Every block should be individually available, as if they had been synched one at a time
+    for (block_number_t i = 0; i < blocks.size(); i++) {
+        WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = i + 1, .includeUncommitted = false };
+        EXPECT_EQ(synched.get_state_reference(revision), ws.get_state_reference(revision));
+
+        std::vector<std::optional<block_number_t>> blockNumbers;
+        synched.get_block_numbers_for_leaf_indices(
+            WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, { 2UL * i, 2UL * i + 1 }, blockNumbers);
+        std::vector<std::optional<block_number_t>> expectedBlockNumbers{ i + 1, i + 1 };
+        EXPECT_EQ(blockNumbers, expectedBlockNumbers);
+    }
+
+    // Unwinding relies on the node reference counts written by the combined commit
+    synched.unwind_blocks(2);
+    EXPECT_EQ(synched.get_state_reference(WorldStateRevision::committed()), blocks[1].blockStateRef);
+    assert_leaf_status<fr>(synched, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, 3, true);
+    assert_leaf_status<fr>(synched, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, 4, false);
+
+    std::filesystem::remove_all(other_data_dir);
+}
+
+TEST_F(WorldStateTest, RejectSyncMultipleBlocksWithInvalidBlock)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    StateReference initial_state_ref = ws.get_state_reference(WorldStateRevision::committed());
+    WorldStateStatusSummary initial_status;
+    ws.get_status_summary(initial_status);
+
+    std::vector<SyncBlockData> blocks;
+    blocks.push_back(SyncBlockData{ .blockStateRef = initial_state_ref, .blockHeaderHash = fr(1) });
+    // The second block claims a state that its updates don't produce
+    blocks.push_back(
+        SyncBlockData{ .blockStateRef = initial_state_ref, .blockHeaderHash = fr(2), .notes = { fr(42) } });
+
+    EXPECT_THROW(ws.sync_blocks(blocks), std::runtime_error);
+
+    // Neither block is committed, and nothing is left uncommitted
+    WorldStateStatusSummary status;
+    ws.get_status_summary(status);
+    EXPECT_EQ(status, initial_status);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::uncommitted()), initial_state_ref);
+    assert_leaf_exists(ws, WorldStateRevision::uncommitted(), MerkleTreeId::ARCHIVE, fr(1), false);
+
+    // The first block alone can still be synched
+    blocks.pop_back();
+    WorldStateStatusFull sync_status = ws.sync_blocks(blocks);
+    WorldStateStatusSummary expected_after_sync{ 1, 0, 1, true };
+    EXPECT_EQ(sync_status.summary, expected_after_sync);
+}
+
 TEST_F(WorldStateTest, ForkingAtBlock0SameState)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -778,6 +867,38 @@ TEST_F(WorldStateTest, ForkingAtBlock0SameState)
     assert_fork_state_unchanged(ws, fork_id, true);
 }
 
+TEST_F(WorldStateTest, ForkStats)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    EXPECT_EQ(ws.get_fork_stats(), WorldStateForkStats{});
+
+    // Writes to the canonical fork are not counted
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(42) });
+    EXPECT_EQ(ws.get_fork_stats(), WorldStateForkStats{});
+
+    auto fork_id = ws.create_fork(std::nullopt);
+    auto other_fork_id = ws.create_fork(std::nullopt);
+    WorldStateForkStats stats = ws.get_fork_stats();
+    EXPECT_EQ(stats.numForks, 2);
+
+    // A fork holds memory for its own writes only
+    std::vector<fr> leaves(100);
+    for (size_t i = 0; i < leaves.size(); i++) {
+        leaves[i] = fr(i);
+    }
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, leaves, fork_id);
+    WorldStateForkStats after_append = ws.get_fork_stats();
+    EXPECT_EQ(after_append.numForks, 2);
+    EXPECT_GT(after_append.overlayBytes, stats.overlayBytes + (leaves.size() * sizeof(fr)));
+
+    // The remaining fork is unmodified, so holds half of what the two unmodified forks did
+    ws.delete_fork(fork_id);
+    WorldStateForkStats expected{ .numForks = 1, .overlayBytes = stats.overlayBytes / 2 };
+    EXPECT_EQ(ws.get_fork_stats(), expected);
+    ws.delete_fork(other_fork_id);
+    EXPECT_EQ(ws.get_fork_stats(), WorldStateForkStats{});
+}
+
 TEST_F(WorldStateTest, ForkingAtBlock0AndAdvancingFork)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
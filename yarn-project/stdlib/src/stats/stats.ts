@@ -197,8 +197,10 @@ export type L2BlockBuiltStats = {
 export type L2BlockHandledStats = {
   /** Name of the event. */
   eventName: 'l2-block-handled';
-  /** Total duration in ms. */
-  duration: number;
+  /** Time in ms to sync the whole batch this block was synced in. Blocks in a batch are not timed individually. */
+  batchDuration: number;
+  /** Number of blocks synced in the same batch as this one. */
+  batchSize: number;
   /** Pending block number. */
   unfinalisedBlockNumber: bigint;
   /** Proven block number. */
@@ -46,6 +46,10 @@ export enum WorldStateMessageType {
 
   COPY_STORES,
 
+  SYNC_BLOCKS,
+
+  GET_FORK_STATS,
+
   CLOSE = 999,
 }
 
@@ -139,6 +143,13 @@ export interface WorldStateDBStats {
   nullifierTreeStats: TreeDBStats;
 }
 
+export interface WorldStateForkStats {
+  /** The number of open forks, not including the canonical fork */
+  numForks: bigint;
+  /** An estimate of the memory held by the uncommitted state of those forks, in bytes */
+  overlayBytes: bigint;
+}
+
 export interface WorldStateStatusFull {
   summary: WorldStateStatusSummary;
   dbStats: WorldStateDBStats;
@@ -270,6 +281,12 @@ export function sanitiseWorldStateTreeMeta(meta: WorldStateMeta) {
   return meta;
 }
 
+export function sanitiseForkStats(stats: WorldStateForkStats) {
+  stats.numForks = BigInt(stats.numForks);
+  stats.overlayBytes = BigInt(stats.overlayBytes);
+  return stats;
+}
+
 export function sanitiseFullStatus(status: WorldStateStatusFull) {
   status.dbStats = sanitiseWorldStateDBStats(status.dbStats);
   status.summary = sanitiseSummary(status.summary);
@@ -417,6 +434,11 @@ interface SyncBlockRequest extends WithCanonicalForkId {
   publicDataWrites: readonly SerializedLeafValue[];
 }
 
+interface SyncBlocksRequest extends WithCanonicalForkId {
+  /** Consecutive blocks, committed together once all of them have been applied */
+  blocks: readonly Omit<SyncBlockRequest, 'canonical'>[];
+}
+
 interface CreateForkRequest extends WithCanonicalForkId {
   latest: boolean;
   blockNumber: number;
@@ -471,6 +493,7 @@ export type WorldStateRequest = {
   [WorldStateMessageType.ROLLBACK]: WithCanonicalForkId;
 
   [WorldStateMessageType.SYNC_BLOCK]: SyncBlockRequest;
+  [WorldStateMessageType.SYNC_BLOCKS]: SyncBlocksRequest;
 
   [WorldStateMessageType.CREATE_FORK]: CreateForkRequest;
   [WorldStateMessageType.DELETE_FORK]: DeleteForkRequest;
@@ -489,6 +512,8 @@ export type WorldStateRequest = {
 
   [WorldStateMessageType.COPY_STORES]: CopyStoresRequest;
 
+  [WorldStateMessageType.GET_FORK_STATS]: WithCanonicalForkId;
+
   [WorldStateMessageType.CLOSE]: WithCanonicalForkId;
 };
 
@@ -516,6 +541,7 @@ export type WorldStateResponse = {
   [WorldStateMessageType.ROLLBACK]: void;
 
   [WorldStateMessageType.SYNC_BLOCK]: WorldStateStatusFull;
+  [WorldStateMessageType.SYNC_BLOCKS]: WorldStateStatusFull;
 
   [WorldStateMessageType.CREATE_FORK]: CreateForkResponse;
   [WorldStateMessageType.DELETE_FORK]: void;
@@ -534,6 +560,8 @@ export type WorldStateResponse = {
 
   [WorldStateMessageType.COPY_STORES]: void;
 
+  [WorldStateMessageType.GET_FORK_STATS]: WorldStateForkStats;
+
   [WorldStateMessageType.CLOSE]: void;
 };
 
@@ -337,6 +337,25 @@ describe('NativeWorldState', () => {
       const forkAtZero = await ws.fork(0);
       await compareChains(forkAtGenesis, forkAtZero);
     });
+
+    it('reports fork stats', async () => {
+      await expect(ws.getForkStats()).resolves.toEqual({ numForks: 0n, overlayBytes: 0n });
+
+      const fork = await ws.fork();
+      const otherFork = await ws.fork();
+      const emptyForkStats = await ws.getForkStats();
+      expect(emptyForkStats.numForks).toBe(2n);
+
+      // Writes to a fork are held in its overlay until it is closed
+      await fork.appendLeaves(MerkleTreeId.NOTE_HASH_TREE, Array.from({ length: 64 }, () => Fr.random()));
+      const writtenForkStats = await ws.getForkStats();
+      expect(writtenForkStats.numForks).toBe(2n);
+      expect(writtenForkStats.overlayBytes).toBeGreaterThan(emptyForkStats.overlayBytes);
+
+      await fork.close();
+      await otherFork.close();
+      await expect(ws.getForkStats()).resolves.toEqual({ numForks: 0n, overlayBytes: 0n });
+    });
   });
 
   describe('Pending and Proven chain', () => {
@@ -394,6 +413,47 @@ describe('NativeWorldState', () => {
       expect(status.finalisedBlockNumber).toBe(8n);
     });
 
+    it('syncs a run of blocks in one request', async () => {
+      const fork = await ws.fork();
+      const blocks: L2Block[] = [];
+      const messages: Fr[][] = [];
+      for (let blockNumber = 1; blockNumber <= 4; blockNumber++) {
+        const { block, messages: blockMessages } = await mockBlock(blockNumber, 1, fork);
+        blocks.push(block);
+        messages.push(blockMessages);
+      }
+
+      const status = await ws.handleL2BlocksAndMessages(blocks, messages);
+      expect(status.summary.unfinalisedBlockNumber).toBe(4n);
+      expect(status.summary.finalisedBlockNumber).toBe(0n);
+      await assertSameState(fork, ws.getCommitted());
+
+      // Every block in the run is recorded as its own block
+      for (const block of blocks) {
+        expect(await ws.getSnapshot(block.number).getStateReference()).toEqual(block.header.state);
+      }
+      await fork.close();
+    });
+
+    it('does not commit any block of a run if one of them fails', async () => {
+      const fork = await ws.fork();
+      const { block: block1, messages: messages1 } = await mockBlock(1, 1, fork);
+      await mockBlock(2, 1, fork);
+      const { block: block3, messages: messages3 } = await mockBlock(3, 1, fork);
+      await fork.close();
+
+      // Block 2 is missing, so block 3 does not apply on top of block 1
+      await expect(ws.handleL2BlocksAndMessages([block1, block3], [messages1, messages3])).rejects.toThrow();
+
+      const summary = await ws.getStatusSummary();
+      expect(summary.unfinalisedBlockNumber).toBe(0n);
+      expect(summary.treesAreSynched).toBe(true);
+
+      // The failed run leaves nothing behind, so the first block can still be synced
+      const status = await ws.handleL2BlocksAndMessages([block1], [messages1]);
+      expect(status.summary.unfinalisedBlockNumber).toBe(1n);
+    });
+
     it('can prune historic blocks', async () => {
       const fork = await ws.fork();
       const forks = [];
@@ -26,10 +26,12 @@ import type { WorldStateTreeMapSizes } from '../synchronizer/factory.js';
 import type { MerkleTreeAdminDatabase as MerkleTreeDatabase } from '../world-state-db/merkle_tree_db.js';
 import { MerkleTreesFacade, MerkleTreesForkFacade, serializeLeaf } from './merkle_trees_facade.js';
 import {
+  type WorldStateForkStats,
   WorldStateMessageType,
   type WorldStateStatusFull,
   type WorldStateStatusSummary,
   blockStateReference,
+  sanitiseForkStats,
   sanitiseFullStatus,
   sanitiseSummary,
   treeStateReferenceToSnapshot,
@@ -39,7 +41,7 @@ import { NativeWorldState } from './native_world_state_instance.js';
 
 // The current version of the world state database schema
 // Increment this when making incompatible changes to the database schema
-export const WORLD_STATE_DB_VERSION = 2; // The initial version
+export const WORLD_STATE_DB_VERSION = 3; // Version 3: binary tree node and block payloads
 
 export const WORLD_STATE_DIR = 'world_state';
 
@@ -168,6 +170,40 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
   }
 
   public async handleL2BlockAndMessages(l2Block: L2Block, l1ToL2Messages: Fr[]): Promise<WorldStateStatusFull> {
+    const block = await this.buildSyncBlockRequest(l2Block, l1ToL2Messages);
+    try {
+      return await this.instance.call(
+        WorldStateMessageType.SYNC_BLOCK,
+        { ...block, canonical: true },
+        this.sanitiseAndCacheSummaryFromFull.bind(this),
+        this.deleteCachedSummary.bind(this),
+      );
+    } catch (err) {
+      this.worldStateInstrumentation.incCriticalErrors('synch_pending_block');
+      throw err;
+    }
+  }
+
+  public async handleL2BlocksAndMessages(l2Blocks: L2Block[], l1ToL2Messages: Fr[][]): Promise<WorldStateStatusFull> {
+    assert.strictEqual(l2Blocks.length, l1ToL2Messages.length, 'Expected one set of L1 to L2 messages per block');
+    if (l2Blocks.length === 1) {
+      return await this.handleL2BlockAndMessages(l2Blocks[0], l1ToL2Messages[0]);
+    }
+    const blocks = await Promise.all(l2Blocks.map((block, i) => this.buildSyncBlockRequest(block, l1ToL2Messages[i])));
+    try {
+      return await this.instance.call(
+        WorldStateMessageType.SYNC_BLOCKS,
+        { blocks, canonical: true },
+        this.sanitiseAndCacheSummaryFromFull.bind(this),
+        this.deleteCachedSummary.bind(this),
+      );
+    } catch (err) {
+      this.worldStateInstrumentation.incCriticalErrors('synch_pending_block');
+      throw err;
+    }
+  }
+
+  private async buildSyncBlockRequest(l2Block: L2Block, l1ToL2Messages: Fr[]) {
     // We have to pad both the values within tx effects because that's how the trees are built by circuits.
     const paddedNoteHashes = l2Block.body.txEffects.flatMap(txEffect =>
       padArrayEnd(txEffect.noteHashes, Fr.ZERO, MAX_NOTE_HASHES_PER_TX),
@@ -187,26 +223,15 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
       });
     });
 
-    try {
-      return await this.instance.call(
-        WorldStateMessageType.SYNC_BLOCK,
-        {
-          blockNumber: l2Block.number,
-          blockHeaderHash: await l2Block.header.hash(),
-          paddedL1ToL2Messages: paddedL1ToL2Messages.map(serializeLeaf),
-          paddedNoteHashes: paddedNoteHashes.map(serializeLeaf),
-          paddedNullifiers: paddedNullifiers.map(serializeLeaf),
-          publicDataWrites: publicDataWrites.map(serializeLeaf),
-          blockStateRef: blockStateReference(l2Block.header.state),
-          canonical: true,
-        },
-        this.sanitiseAndCacheSummaryFromFull.bind(this),
-        this.deleteCachedSummary.bind(this),
-      );
-    } catch (err) {
-      this.worldStateInstrumentation.incCriticalErrors('synch_pending_block');
-      throw err;
-    }
+    return {
+      blockNumber: l2Block.number,
+      blockHeaderHash: await l2Block.header.hash(),
+      paddedL1ToL2Messages: paddedL1ToL2Messages.map(serializeLeaf),
+      paddedNoteHashes: paddedNoteHashes.map(serializeLeaf),
+      paddedNullifiers: paddedNullifiers.map(serializeLeaf),
+      publicDataWrites: publicDataWrites.map(serializeLeaf),
+      blockStateRef: blockStateReference(l2Block.header.state),
+    };
   }
 
   public async close(): Promise<void> {
@@ -313,6 +338,14 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
     );
   }
 
+  /**
+   * Gets the number of open forks and an estimate of the memory held by their uncommitted state
+   * @returns The fork stats
+   */
+  public getForkStats(): Promise<WorldStateForkStats> {
+    return this.instance.call(WorldStateMessageType.GET_FORK_STATS, { canonical: true }, sanitiseForkStats);
+  }
+
   updateLeaf<ID extends IndexedTreeId>(
     _treeId: ID,
     _leaf: NullifierLeafPreimage | Buffer,
@@ -31,6 +31,7 @@ describe('ServerWorldStateSynchronizer', () => {
 
   let server: TestWorldStateSynchronizer;
   let latestHandledBlockNumber: number;
+  let handledBlockCount: number;
 
   const LATEST_BLOCK_NUMBER = 5;
 
@@ -60,11 +61,13 @@ describe('ServerWorldStateSynchronizer', () => {
 
     merkleTreeDb = mock<MerkleTreeAdminDatabase>();
     merkleTreeDb.getCommitted.mockReturnValue(merkleTreeRead);
-    merkleTreeDb.handleL2BlockAndMessages.mockImplementation((l2Block: L2Block) => {
-      latestHandledBlockNumber = l2Block.number;
+    merkleTreeDb.handleL2BlocksAndMessages.mockImplementation((l2Blocks: L2Block[]) => {
+      latestHandledBlockNumber = l2Blocks.at(-1)!.number;
+      handledBlockCount += l2Blocks.length;
       return Promise.resolve(buildEmptyWorldStateStatusFull());
     });
     latestHandledBlockNumber = 0;
+    handledBlockCount = 0;
 
     merkleTreeDb.getStatusSummary.mockResolvedValue({
       unfinalisedBlockNumber: BigInt(latestHandledBlockNumber),
@@ -133,7 +136,21 @@ describe('ServerWorldStateSynchronizer', () => {
 
     // and check the final status
     await expectServerStatus(WorldStateRunningState.STOPPED, 5);
-    expect(merkleTreeDb.handleL2BlockAndMessages).toHaveBeenCalledTimes(5);
+    expect(handledBlockCount).toEqual(5);
+  });
+
+  it('syncs each batch of blocks with a single call', async () => {
+    void server.start();
+    await pushBlocks(1, 3);
+    await pushBlocks(4, 5);
+
+    await expectServerStatus(WorldStateRunningState.RUNNING, 5);
+    expect(merkleTreeDb.handleL2BlocksAndMessages).toHaveBeenCalledTimes(2);
+    expect(merkleTreeDb.handleL2BlocksAndMessages.mock.calls.map(([blocks]) => blocks.map(b => b.number))).toEqual([
+      [1, 2, 3],
+      [4, 5],
+    ]);
+    expect(merkleTreeDb.handleL2BlockAndMessages).not.toHaveBeenCalled();
   });
 
   it('handles multiple calls to start', async () => {
@@ -146,7 +163,7 @@ describe('ServerWorldStateSynchronizer', () => {
     await server.start();
 
     await expectServerStatus(WorldStateRunningState.RUNNING, 5);
-    expect(merkleTreeDb.handleL2BlockAndMessages).toHaveBeenCalledTimes(5);
+    expect(handledBlockCount).toEqual(5);
   });
 
   it('immediately syncs if no new blocks', async () => {
@@ -173,7 +190,7 @@ describe('ServerWorldStateSynchronizer', () => {
     await server.syncImmediate();
 
     await expectServerStatus(WorldStateRunningState.RUNNING, 7);
-    expect(merkleTreeDb.handleL2BlockAndMessages).toHaveBeenCalledTimes(7);
+    expect(handledBlockCount).toEqual(7);
   });
 
   it('can immediately sync to a minimum block number', async () => {
@@ -184,7 +201,7 @@ describe('ServerWorldStateSynchronizer', () => {
     await server.syncImmediate(7);
 
     await expectServerStatus(WorldStateRunningState.RUNNING, 8);
-    expect(merkleTreeDb.handleL2BlockAndMessages).toHaveBeenCalledTimes(8);
+    expect(handledBlockCount).toEqual(8);
   });
 
   it('sync returns immediately if block was already synced', async () => {
@@ -195,7 +212,7 @@ describe('ServerWorldStateSynchronizer', () => {
     expect(l2BlockStream.sync).not.toHaveBeenCalled();
 
     await expectServerStatus(WorldStateRunningState.RUNNING, 5);
-    expect(merkleTreeDb.handleL2BlockAndMessages).toHaveBeenCalledTimes(5);
+    expect(handledBlockCount).toEqual(5);
   });
 
   it('throws if you try to sync to an unavailable block', async () => {
@@ -211,7 +228,7 @@ describe('ServerWorldStateSynchronizer', () => {
 
   it('throws if handling blocks fails', async () => {
     void server.start();
-    merkleTreeDb.handleL2BlockAndMessages.mockRejectedValue(new Error('Test error'));
+    merkleTreeDb.handleL2BlocksAndMessages.mockRejectedValue(new Error('Test error'));
     await expect(pushBlocks(1, 5)).rejects.toThrow(/Test error/i);
   });
 });
@@ -28,7 +28,6 @@ import { MerkleTreeId, type MerkleTreeReadOperations, type MerkleTreeWriteOperat
 import { TraceableL2BlockStream, getTelemetryClient } from '@aztec/telemetry-client';
 
 import { WorldStateInstrumentation } from '../instrumentation/instrumentation.js';
-import type { WorldStateStatusFull } from '../native/message.js';
 import type { MerkleTreeAdminDatabase } from '../world-state-db/merkle_tree_db.js';
 import type { WorldStateConfig } from './config.js';
 import { WorldStateSynchronizerError } from './errors.js';
@@ -276,61 +275,47 @@ export class ServerWorldStateSynchronizer
 
   /**
    * Handles a list of L2 blocks (i.e. Inserts the new note hashes into the merkle tree).
+   * The blocks are synced together, so the trees are committed once for the whole list.
    * @param l2Blocks - The L2 blocks to handle.
-   * @returns Whether the block handled was produced by this same node.
    */
   private async handleL2Blocks(l2Blocks: L2Block[]) {
     this.log.trace(`Handling L2 blocks ${l2Blocks[0].number} to ${l2Blocks.at(-1)!.number}`);
 
     const messagePromises = l2Blocks.map(block => this.l2BlockSource.getL1ToL2Messages(block.number));
     const l1ToL2Messages: Fr[][] = await Promise.all(messagePromises);
-    let updateStatus: WorldStateStatusFull | undefined = undefined;
 
+    // First we check that the L1 to L2 messages hash to the block inHash.
+    // Note that we cannot optimize this check by checking the root of the subtree after inserting the messages
+    // to the real L1_TO_L2_MESSAGE_TREE (like we do in merkleTreeDb.handleL2BlocksAndMessages(...)) because that
+    // tree uses pedersen and we don't have access to the converted root.
     for (let i = 0; i < l2Blocks.length; i++) {
-      const [duration, result] = await elapsed(() => this.handleL2Block(l2Blocks[i], l1ToL2Messages[i]));
-      this.log.info(`World state updated with L2 block ${l2Blocks[i].number}`, {
+      await this.verifyMessagesHashToInHash(l1ToL2Messages[i], l2Blocks[i].header.contentCommitment.inHash);
+    }
+
+    // If the above checks succeed, we can proceed to handle the blocks.
+    this.log.trace(`Pushing L2 blocks ${l2Blocks[0].number} to ${l2Blocks.at(-1)!.number} to merkle tree db`);
+    const [duration, result] = await elapsed(() =>
+      this.merkleTreeDb.handleL2BlocksAndMessages(l2Blocks, l1ToL2Messages),
+    );
+    for (const l2Block of l2Blocks) {
+      this.log.info(`World state updated with L2 block ${l2Block.number}`, {
         eventName: 'l2-block-handled',
-        duration,
+        batchDuration: duration,
+        batchSize: l2Blocks.length,
         unfinalisedBlockNumber: result.summary.unfinalisedBlockNumber,
         finalisedBlockNumber: result.summary.finalisedBlockNumber,
         oldestHistoricBlock: result.summary.oldestHistoricalBlock,
-        ...l2Blocks[i].getStats(),
+        ...l2Block.getStats(),
       } satisfies L2BlockHandledStats);
-      updateStatus = result;
-    }
-    if (!updateStatus) {
-      return;
     }
-    this.instrumentation.updateWorldStateMetrics(updateStatus);
-  }
-
-  /**
-   * Handles a single L2 block (i.e. Inserts the new note hashes into the merkle tree).
-   * @param l2Block - The L2 block to handle.
-   * @param l1ToL2Messages - The L1 to L2 messages for the block.
-   * @returns Whether the block handled was produced by this same node.
-   */
-  private async handleL2Block(l2Block: L2Block, l1ToL2Messages: Fr[]): Promise<WorldStateStatusFull> {
-    // First we check that the L1 to L2 messages hash to the block inHash.
-    // Note that we cannot optimize this check by checking the root of the subtree after inserting the messages
-    // to the real L1_TO_L2_MESSAGE_TREE (like we do in merkleTreeDb.handleL2BlockAndMessages(...)) because that
-    // tree uses pedersen and we don't have access to the converted root.
-    await this.verifyMessagesHashToInHash(l1ToL2Messages, l2Block.header.contentCommitment.inHash);
-
-    // If the above check succeeds, we can proceed to handle the block.
-    this.log.trace(`Pushing L2 block ${l2Block.number} to merkle tree db `, {
-      blockNumber: l2Block.number,
-      blockHash: await l2Block.hash().then(h => h.toString()),
-      l1ToL2Messages: l1ToL2Messages.map(msg => msg.toString()),
-    });
-    const result = await this.merkleTreeDb.handleL2BlockAndMessages(l2Block, l1ToL2Messages);
 
-    if (this.currentState === WorldStateRunningState.SYNCHING && l2Block.number >= this.latestBlockNumberAtStart) {
+    const lastBlockNumber = l2Blocks.at(-1)!.number;
+    if (this.currentState === WorldStateRunningState.SYNCHING && lastBlockNumber >= this.latestBlockNumberAtStart) {
       this.setCurrentState(WorldStateRunningState.RUNNING);
       this.syncPromise.resolve();
     }
 
-    return result;
+    this.instrumentation.updateWorldStateMetrics(result);
   }
 
   private async handleChainFinalized(blockNumber: number) {
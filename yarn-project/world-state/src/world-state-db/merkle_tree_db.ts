@@ -42,6 +42,14 @@ export interface MerkleTreeAdminDatabase extends ForkMerkleTreeOperations {
    */
   handleL2BlockAndMessages(block: L2Block, l1ToL2Messages: Fr[]): Promise<WorldStateStatusFull>;
 
+  /**
+   * Handles a run of consecutive L2 blocks, committing the trees once after the last block.
+   * If any block fails, none of them are committed.
+   * @param blocks - The L2 blocks to handle, in order.
+   * @param l1ToL2Messages - The L1 to L2 messages for each block.
+   */
+  handleL2BlocksAndMessages(blocks: L2Block[], l1ToL2Messages: Fr[][]): Promise<WorldStateStatusFull>;
+
   /**
    * Gets a handle that allows reading the latest committed state
    */